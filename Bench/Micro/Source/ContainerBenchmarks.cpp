@@ -0,0 +1,366 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file ContainerBenchmarks.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Harness/Benchmark.hpp"
+
+#include <Liger-Engine/Core/Containers/DependencyGraph.hpp>
+#include <Liger-Engine/Core/Containers/DynamicBVH.hpp>
+#include <Liger-Engine/Core/Containers/RefCountStorage.hpp>
+#include <Liger-Engine/Core/Containers/SlotMap.hpp>
+#include <Liger-Engine/Core/Containers/TypeMap.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <random>
+
+namespace liger::microbench {
+
+namespace {
+
+constexpr int64_t  kMinSize  = 1;
+constexpr int64_t  kMaxSize  = 100'000;
+constexpr uint32_t kRandSeed = 42U;
+
+/************************************************************************************************
+ * RefCountStorage
+ ************************************************************************************************/
+using RefStorage = RefCountStorage<uint64_t, uint64_t>;
+
+void BM_RefCountStorageEmplaceRelease(State& state) {
+  const auto size = static_cast<uint64_t>(state.Arg());
+
+  RefStorage                         storage;
+  std::vector<RefStorage::Reference> references;
+  references.reserve(size);
+
+  for (auto _ : state) {
+    for (uint64_t key = 0U; key < size; ++key) {
+      references.emplace_back(storage.Emplace(key));
+    }
+
+    references.clear();
+    storage.CleanUp();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_RefCountStorageEmplaceRelease)->Range(kMinSize, kMaxSize);
+
+void BM_RefCountStorageGet(State& state) {
+  const auto size = static_cast<uint64_t>(state.Arg());
+
+  RefStorage                         storage;
+  std::vector<RefStorage::Reference> references;
+  for (uint64_t key = 0U; key < size; ++key) {
+    references.emplace_back(storage.Emplace(key));
+  }
+
+  std::mt19937_64                         generator(kRandSeed);
+  std::uniform_int_distribution<uint64_t> key_distribution(0U, size - 1U);
+
+  std::vector<uint64_t> keys(4096U);
+  for (auto& key : keys) {
+    key = key_distribution(generator);
+  }
+
+  size_t key_idx = 0U;
+  for (auto _ : state) {
+    auto reference = storage.Get(keys[key_idx]);
+    DoNotOptimize(*reference);
+    key_idx = (key_idx + 1U) % keys.size();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_RefCountStorageGet)->Range(kMinSize, kMaxSize);
+
+/* Copies of a single reference from several threads, i.e. the ref counter of a popular asset */
+std::optional<RefStorage>            g_shared_storage;
+std::optional<RefStorage::Reference> g_shared_reference;
+
+void BM_RefCountStorageReferenceCopyContended(State& state) {
+  const auto& shared_reference = *g_shared_reference;
+
+  for (auto _ : state) {
+    RefStorage::Reference copy = shared_reference;
+    DoNotOptimize(*copy);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_RefCountStorageReferenceCopyContended)
+    ->Threads(1U)
+    ->Threads(2U)
+    ->Threads(4U)
+    ->Threads(8U)
+    ->Setup([](const State&) {
+      g_shared_storage.emplace();
+      g_shared_reference.emplace(g_shared_storage->Emplace(0U));
+    })
+    ->Teardown([](const State&) {
+      g_shared_reference.reset();
+      g_shared_storage.reset();
+    });
+
+/************************************************************************************************
+ * SlotMap
+ ************************************************************************************************/
+void BM_SlotMapEmplaceErase(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  SlotMap<uint64_t>       slot_map(size, FreeListPolicy::LowestIndexFirst);
+  std::vector<SlotHandle> handles;
+  handles.reserve(size);
+
+  for (auto _ : state) {
+    for (uint32_t value = 0U; value < size; ++value) {
+      handles.push_back(slot_map.Emplace(value));
+    }
+
+    for (auto handle : handles) {
+      slot_map.Erase(handle);
+    }
+
+    handles.clear();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_SlotMapEmplaceErase)->Range(kMinSize, kMaxSize);
+
+void BM_SlotMapGet(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  SlotMap<uint64_t>       slot_map(size);
+  std::vector<SlotHandle> handles;
+  for (uint32_t value = 0U; value < size; ++value) {
+    handles.push_back(slot_map.Emplace(value));
+  }
+
+  std::mt19937 rng(kRandSeed);
+  std::shuffle(handles.begin(), handles.end(), rng);
+
+  for (auto _ : state) {
+    for (auto handle : handles) {
+      DoNotOptimize(slot_map.Get(handle));
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_SlotMapGet)->Range(kMinSize, kMaxSize);
+
+/************************************************************************************************
+ * TypeMap
+ ************************************************************************************************/
+template <typename T>
+using TypeMapValue = uint64_t;
+
+template <size_t I>
+struct TypeTag {};
+
+template <size_t... Is>
+uint64_t TouchAll(TypeMap<TypeMapValue>& map, std::index_sequence<Is...>) {
+  return (map.Get<TypeTag<Is>>() + ...);
+}
+
+void BM_TypeMapGet(State& state) {
+  constexpr size_t kTypeCount = 32U;
+
+  TypeMap<TypeMapValue> map;
+  TouchAll(map, std::make_index_sequence<kTypeCount>());
+
+  for (auto _ : state) {
+    DoNotOptimize(TouchAll(map, std::make_index_sequence<kTypeCount>()));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * kTypeCount));
+}
+LIGER_MICROBENCHMARK(BM_TypeMapGet);
+
+/************************************************************************************************
+ * DAG
+ ************************************************************************************************/
+constexpr uint32_t kEdgesPerNode = 4U;
+
+/* Random DAG in which each node depends on a few nodes declared before it, similar to render graph passes */
+DAG<void> MakeRandomDAG(uint32_t size) {
+  DAG<void> dag(size);
+
+  std::mt19937 generator(kRandSeed);
+  for (uint32_t to = 1U; to < size; ++to) {
+    std::uniform_int_distribution<uint32_t> from_distribution(0U, to - 1U);
+    for (uint32_t edge = 0U; edge < kEdgesPerNode; ++edge) {
+      dag.AddEdge(from_distribution(generator), to);
+    }
+  }
+
+  return dag;
+}
+
+void BM_DAGBuild(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  for (auto _ : state) {
+    auto dag = MakeRandomDAG(size);
+    DoNotOptimize(dag);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_DAGBuild)->Range(kMinSize, kMaxSize);
+
+void BM_DAGTopologicalSort(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+  const auto dag  = MakeRandomDAG(size);
+
+  DAG<void>::SortedList sorted;
+  DAG<void>::DepthList  depth;
+  DAG<void>::Depth      max_depth{0U};
+
+  for (auto _ : state) {
+    DoNotOptimize(dag.TopologicalSort(sorted, depth, max_depth));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_DAGTopologicalSort)->Range(kMinSize, kMaxSize);
+
+void BM_DAGTransitiveReduction(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+  const auto dag  = MakeRandomDAG(size);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto reduced = dag;
+    state.ResumeTiming();
+
+    DoNotOptimize(reduced.TransitiveReduction());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+/* Limited by the quadratic memory of the reachability matrix */
+LIGER_MICROBENCHMARK(BM_DAGTransitiveReduction)->Range(kMinSize, 10'000);
+
+/************************************************************************************************
+ * DynamicBVH
+ ************************************************************************************************/
+constexpr float kWorldExtent = 500.0f;
+
+std::vector<AABB> MakeRandomBoxes(uint32_t size) {
+  std::mt19937                          generator(kRandSeed);
+  std::uniform_real_distribution<float> position(-kWorldExtent, kWorldExtent);
+  std::uniform_real_distribution<float> extent(0.5f, 2.0f);
+
+  std::vector<AABB> boxes(size);
+  for (auto& box : boxes) {
+    box = AABB::FromCenterExtent(glm::vec3(position(generator), position(generator), position(generator)),
+                                 glm::vec3(extent(generator)));
+  }
+
+  return boxes;
+}
+
+void BM_DynamicBVHQuery(State& state) {
+  const auto size  = static_cast<uint32_t>(state.Arg());
+  const auto boxes = MakeRandomBoxes(size);
+
+  DynamicBVH bvh;
+  for (uint32_t i = 0U; i < size; ++i) {
+    [[maybe_unused]] auto proxy = bvh.CreateProxy(boxes[i], i);
+  }
+  bvh.Commit();
+
+  const Sphere query{.center = glm::vec3(0.0f), .radius = 0.1f * kWorldExtent};
+
+  for (auto _ : state) {
+    uint32_t hits = 0U;
+    bvh.Query(query, [&hits](uint32_t) { ++hits; });
+    DoNotOptimize(hits);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_DynamicBVHQuery)->Range(kMinSize, kMaxSize);
+
+/* Baseline the BVH query is compared against */
+void BM_LinearScanQuery(State& state) {
+  const auto size  = static_cast<uint32_t>(state.Arg());
+  const auto boxes = MakeRandomBoxes(size);
+
+  const Sphere query{.center = glm::vec3(0.0f), .radius = 0.1f * kWorldExtent};
+
+  for (auto _ : state) {
+    uint32_t hits = 0U;
+    for (const auto& box : boxes) {
+      hits += query.Overlaps(box) ? 1U : 0U;
+    }
+    DoNotOptimize(hits);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_LinearScanQuery)->Range(kMinSize, kMaxSize);
+
+/* A tenth of the objects moves a little every frame, as in a mostly static scene */
+void BM_DynamicBVHMoveCommit(State& state) {
+  const auto size  = static_cast<uint32_t>(state.Arg());
+  auto       boxes = MakeRandomBoxes(size);
+
+  DynamicBVH            bvh;
+  std::vector<uint32_t> proxies(size);
+  for (uint32_t i = 0U; i < size; ++i) {
+    proxies[i] = bvh.CreateProxy(boxes[i], i);
+  }
+  bvh.Commit();
+
+  std::mt19937                          generator(kRandSeed);
+  std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+  const uint32_t moved_count = std::max(1U, size / 10U);
+
+  for (auto _ : state) {
+    for (uint32_t i = 0U; i < moved_count; ++i) {
+      const uint32_t idx   = generator() % size;
+      const glm::vec3 step = glm::vec3(offset(generator), offset(generator), offset(generator));
+
+      boxes[idx] = AABB{.min = boxes[idx].min + step, .max = boxes[idx].max + step};
+      bvh.MoveProxy(proxies[idx], boxes[idx]);
+    }
+
+    bvh.Commit();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * moved_count));
+}
+LIGER_MICROBENCHMARK(BM_DynamicBVHMoveCommit)->Range(kMinSize, kMaxSize);
+
+}  // namespace
+
+}  // namespace liger::microbench
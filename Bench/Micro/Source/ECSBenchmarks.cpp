@@ -0,0 +1,226 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file ECSBenchmarks.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Harness/Benchmark.hpp"
+
+#include <Liger-Engine/ECS/BuiltIn/TransformHierarchySystem.hpp>
+#include <Liger-Engine/ECS/Prefab.hpp>
+#include <Liger-Engine/ECS/SceneFormat.hpp>
+#include <Liger-Engine/ECS/SystemGraph.hpp>
+
+#include <cmath>
+#include <filesystem>
+
+namespace liger::microbench {
+
+namespace {
+
+/************************************************************************************************
+ * Component system iteration
+ ************************************************************************************************/
+struct Position {
+  float x{0.0f};
+  float y{0.0f};
+  float z{0.0f};
+};
+
+struct Velocity {
+  float x{1.0f};
+  float y{0.5f};
+  float z{0.25f};
+};
+
+class IntegrateSystem : public ecs::ComponentSystem<Position, const Velocity> {
+ public:
+  explicit IntegrateSystem(bool parallel) {
+    if (parallel) {
+      EnableParallelIteration();
+    }
+  }
+
+  void Run(Position& position, const Velocity& velocity) override {
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+
+    position.x = std::fma(velocity.x, kDeltaTime, position.x);
+    position.y = std::fma(velocity.y, kDeltaTime, position.y);
+    position.z = std::fma(velocity.z, kDeltaTime, position.z);
+  }
+
+  std::string_view Name() const override { return "IntegrateSystem<Position, const Velocity>"; }
+};
+
+void RunIntegrateSystem(State& state, bool parallel) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  ecs::Scene scene;
+  for (uint32_t i = 0U; i < size; ++i) {
+    auto entity = scene.CreateEntity();
+    scene.GetRegistry().emplace<Position>(entity);
+    scene.GetRegistry().emplace<Velocity>(entity);
+  }
+
+  ecs::SystemGraph graph;
+  graph.Emplace(std::make_unique<IntegrateSystem>(parallel));
+
+  tf::Executor executor;
+  auto         taskflow = graph.Build(scene);
+
+  for (auto _ : state) {
+    executor.run(taskflow).wait();
+    ClobberMemory();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+
+void BM_ComponentSystemSerial(State& state) { RunIntegrateSystem(state, false); }
+LIGER_MICROBENCHMARK(BM_ComponentSystemSerial)->Range(1'000, 1'000'000);
+
+void BM_ComponentSystemParallel(State& state) { RunIntegrateSystem(state, true); }
+LIGER_MICROBENCHMARK(BM_ComponentSystemParallel)->Range(1'000, 1'000'000);
+
+/************************************************************************************************
+ * Scene files
+ ************************************************************************************************/
+void BM_SceneFileLoad(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  ecs::SceneFormat format;
+  format.RegisterDefaultComponents();
+
+  /* Every other entity is parented to its predecessor, so both bitwise and converted columns are loaded */
+  ecs::Scene source;
+  auto&      source_registry = source.GetRegistry();
+
+  ecs::Entity previous{entt::null};
+  for (uint32_t i = 0U; i < size; ++i) {
+    auto entity = source.CreateEntity();
+    source_registry.emplace<ecs::WorldTransform>(entity);
+    source_registry.emplace<ecs::LocalTransform>(entity);
+
+    if (i % 2U == 1U) {
+      source_registry.emplace<ecs::Parent>(entity, previous);
+    }
+
+    previous = entity;
+  }
+
+  const auto filepath = std::filesystem::temp_directory_path() / "liger-microbench-scene.lscene";
+  if (!format.Save(source, filepath)) {
+    return;
+  }
+
+  for (auto _ : state) {
+    ecs::Scene     scene;
+    ecs::SceneFile file;
+
+    if (file.Open(filepath)) {
+      format.Load(file, scene);
+    }
+
+    DoNotOptimize(scene.GetRegistry().storage<ecs::WorldTransform>().size());
+
+    state.PauseTiming();
+    {
+      /* Destroying the registry is not part of loading */
+      ecs::Scene discarded = std::move(scene);
+    }
+    state.ResumeTiming();
+  }
+
+  std::filesystem::remove(filepath);
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_SceneFileLoad)->Range(1'000, 1'000'000);
+
+/************************************************************************************************
+ * Spawning
+ ************************************************************************************************/
+/* Spawns props with a local transform into a scene with the TransformHierarchySystem listening to their construction */
+template <typename SpawnFunc>
+void RunSpawn(State& state, SpawnFunc&& spawn) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  std::vector<Transform3D> transforms(size);
+  for (uint32_t i = 0U; i < size; ++i) {
+    transforms[i].position = glm::vec3(static_cast<float>(i % 100U), 0.0f, static_cast<float>(i / 100U));
+  }
+
+  tf::Executor executor;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    ecs::Scene       scene;
+    ecs::SystemGraph graph;
+    graph.Emplace(std::make_unique<ecs::TransformHierarchySystem>(executor));
+    auto taskflow = graph.Build(scene);
+    state.ResumeTiming();
+
+    spawn(scene, transforms);
+    DoNotOptimize(scene.GetRegistry().storage<ecs::HierarchyNode>().size());
+
+    state.PauseTiming();
+    {
+      ecs::Scene discarded = std::move(scene);
+    }
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+
+void BM_SpawnOneByOne(State& state) {
+  RunSpawn(state, [](ecs::Scene& scene, const std::vector<Transform3D>& transforms) {
+    auto& registry = scene.GetRegistry();
+
+    for (const auto& transform : transforms) {
+      auto entity = scene.CreateEntity();
+      registry.emplace<ecs::WorldTransform>(entity, transform);
+      registry.emplace<ecs::LocalTransform>(entity, transform);
+      registry.emplace<Position>(entity);
+      registry.emplace<Velocity>(entity);
+    }
+  });
+}
+LIGER_MICROBENCHMARK(BM_SpawnOneByOne)->Range(1'000, 100'000);
+
+void BM_PrefabInstantiate(State& state) {
+  ecs::Prefab prefab;
+  prefab.Add(ecs::LocalTransform{});
+  prefab.Add(Position{});
+  prefab.Add(Velocity{});
+
+  RunSpawn(state, [&prefab](ecs::Scene& scene, const std::vector<Transform3D>& transforms) {
+    scene.Instantiate(prefab, transforms);
+  });
+}
+LIGER_MICROBENCHMARK(BM_PrefabInstantiate)->Range(1'000, 100'000);
+
+}  // namespace
+
+}  // namespace liger::microbench
@@ -0,0 +1,127 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file EventBenchmarks.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Harness/Benchmark.hpp"
+
+#include <Liger-Engine/Core/Event/EventSink.hpp>
+
+#include <optional>
+
+namespace liger::microbench {
+
+namespace {
+
+struct BenchEvent {
+  uint64_t payload;
+};
+
+struct Listener {
+  uint64_t sum{0U};
+
+  bool OnEvent(const BenchEvent& event) {
+    sum += event.payload;
+    return true;
+  }
+};
+
+/************************************************************************************************
+ * EventSink
+ ************************************************************************************************/
+void BM_EventSinkDispatch(State& state) {
+  const auto listener_count = static_cast<size_t>(state.Arg());
+
+  EventSink<BenchEvent> sink;
+  std::vector<Listener> listeners(listener_count);
+  for (auto& listener : listeners) {
+    sink.Connect<&Listener::OnEvent>(listener);
+  }
+
+  for (auto _ : state) {
+    DoNotOptimize(sink.Dispatch(BenchEvent{.payload = 1U}, true));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * listener_count));
+}
+LIGER_MICROBENCHMARK(BM_EventSinkDispatch)->Range(1, 1'000);
+
+void BM_EventSinkEnqueueDispatchQueued(State& state) {
+  const auto event_count = static_cast<uint64_t>(state.Arg());
+
+  EventSink<BenchEvent> sink;
+  Listener              listener;
+  sink.Connect<&Listener::OnEvent>(listener);
+
+  for (auto _ : state) {
+    for (uint64_t event_idx = 0U; event_idx < event_count; ++event_idx) {
+      sink.Enqueue(BenchEvent{.payload = event_idx});
+    }
+
+    DoNotOptimize(sink.DispatchQueued());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * event_count));
+}
+LIGER_MICROBENCHMARK(BM_EventSinkEnqueueDispatchQueued)->Range(1, 100'000);
+
+/* Several producer threads, the first one also drains the queue like the main thread does once per frame */
+constexpr uint64_t kDrainPeriod = 1024U;
+
+std::optional<EventSink<BenchEvent>> g_shared_sink;
+Listener                             g_shared_listener;
+
+void BM_EventSinkEnqueueContended(State& state) {
+  auto&      sink     = *g_shared_sink;
+  const bool consumer = (state.ThreadIndex() == 0U);
+
+  uint64_t event_idx = 0U;
+  for (auto _ : state) {
+    sink.Enqueue(BenchEvent{.payload = event_idx++});
+
+    if (consumer && (event_idx % kDrainPeriod) == 0U) {
+      sink.DispatchQueued();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_EventSinkEnqueueContended)
+    ->Threads(1U)
+    ->Threads(2U)
+    ->Threads(4U)
+    ->Threads(8U)
+    ->Setup([](const State&) {
+      g_shared_sink.emplace();
+      g_shared_sink->Connect<&Listener::OnEvent>(g_shared_listener);
+    })
+    ->Teardown([](const State&) {
+      g_shared_sink->DispatchQueued();
+      g_shared_sink.reset();
+    });
+
+}  // namespace
+
+}  // namespace liger::microbench
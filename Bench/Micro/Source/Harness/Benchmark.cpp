@@ -0,0 +1,290 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file Benchmark.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <latch>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+namespace liger::microbench {
+
+/************************************************************************************************
+ * State
+ ************************************************************************************************/
+State::State(int64_t arg, uint32_t thread_idx, uint32_t thread_count, uint64_t iterations)
+    : arg_(arg), thread_idx_(thread_idx), thread_count_(thread_count), iterations_(iterations) {}
+
+State::Iterator State::begin() {
+  ResumeTiming();
+  return Iterator(this, iterations_);
+}
+
+State::Iterator State::end() { return Iterator(this, 0U); }
+
+int64_t State::Arg() const { return arg_; }
+
+uint32_t State::ThreadIndex() const { return thread_idx_; }
+
+uint32_t State::ThreadCount() const { return thread_count_; }
+
+uint64_t State::Iterations() const { return iterations_; }
+
+void State::PauseTiming() {
+  if (running_) {
+    elapsed_ += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+    running_  = false;
+  }
+}
+
+void State::ResumeTiming() {
+  if (!running_) {
+    start_   = Clock::now();
+    running_ = true;
+  }
+}
+
+void State::SetItemsProcessed(int64_t items) { items_processed_ = items; }
+
+int64_t State::ItemsProcessed() const { return items_processed_; }
+
+std::chrono::nanoseconds State::Elapsed() const { return elapsed_; }
+
+/************************************************************************************************
+ * Benchmark
+ ************************************************************************************************/
+Benchmark::Benchmark(std::string name, BenchmarkFunction function) : name_(std::move(name)), function_(function) {}
+
+Benchmark* Benchmark::Arg(int64_t arg) {
+  args_.push_back(arg);
+  return this;
+}
+
+Benchmark* Benchmark::Range(int64_t start, int64_t limit, int64_t multiplier) {
+  for (int64_t arg = start; arg < limit; arg *= multiplier) {
+    args_.push_back(arg);
+  }
+
+  args_.push_back(limit);
+  return this;
+}
+
+Benchmark* Benchmark::Threads(uint32_t threads) {
+  threads_.push_back(threads);
+  return this;
+}
+
+Benchmark* Benchmark::Setup(FixtureFunction setup) {
+  setup_ = setup;
+  return this;
+}
+
+Benchmark* Benchmark::Teardown(FixtureFunction teardown) {
+  teardown_ = teardown;
+  return this;
+}
+
+const std::string& Benchmark::Name() const { return name_; }
+
+/************************************************************************************************
+ * Runner
+ ************************************************************************************************/
+namespace {
+
+std::vector<std::unique_ptr<Benchmark>>& Registry() {
+  static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+  return benchmarks;
+}
+
+}  // namespace
+
+Benchmark* RegisterBenchmark(std::string name, BenchmarkFunction function) {
+  return Registry().emplace_back(std::make_unique<Benchmark>(std::move(name), function)).get();
+}
+
+class Runner {
+ public:
+  explicit Runner(double min_time_s) : min_time_s_(min_time_s) {}
+
+  void Run(const Benchmark& benchmark) {
+    std::vector<int64_t>  args    = benchmark.args_.empty() ? std::vector<int64_t>{0} : benchmark.args_;
+    std::vector<uint32_t> threads = benchmark.threads_.empty() ? std::vector<uint32_t>{1U} : benchmark.threads_;
+
+    for (auto thread_count : threads) {
+      for (auto arg : args) {
+        std::string name = benchmark.name_;
+        if (!benchmark.args_.empty()) {
+          name += "/" + std::to_string(arg);
+        }
+        if (!benchmark.threads_.empty()) {
+          name += "/threads:" + std::to_string(thread_count);
+        }
+
+        Report(name, Calibrate(benchmark, arg, thread_count));
+      }
+    }
+  }
+
+ private:
+  static constexpr uint64_t kMaxIterations = 1'000'000'000U;
+  static constexpr double   kMaxGrowth     = 10.0;
+
+  struct Result {
+    uint64_t iterations{0U};
+    double   seconds{0.0};
+    int64_t  items{0};
+  };
+
+  Result Calibrate(const Benchmark& benchmark, int64_t arg, uint32_t thread_count) {
+    uint64_t iterations = 1U;
+
+    while (true) {
+      auto result = RunOnce(benchmark, arg, thread_count, iterations);
+      if (result.seconds >= min_time_s_ || iterations >= kMaxIterations) {
+        return result;
+      }
+
+      /* Overshoot a bit to avoid another round, but never grow too fast on a noisy measurement */
+      double multiplier = (result.seconds > 0.0) ? 1.4 * min_time_s_ / result.seconds : kMaxGrowth;
+      multiplier        = std::min(multiplier, kMaxGrowth);
+
+      auto next  = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+      iterations = std::clamp<uint64_t>(next, iterations + 1U, kMaxIterations);
+    }
+  }
+
+  static Result RunOnce(const Benchmark& benchmark, int64_t arg, uint32_t thread_count, uint64_t iterations) {
+    if (benchmark.setup_) {
+      benchmark.setup_(State(arg, 0U, thread_count, iterations));
+    }
+
+    std::vector<State> states;
+    states.reserve(thread_count);
+    for (uint32_t thread_idx = 0U; thread_idx < thread_count; ++thread_idx) {
+      states.emplace_back(arg, thread_idx, thread_count, iterations);
+    }
+
+    if (thread_count == 1U) {
+      benchmark.function_(states[0]);
+    } else {
+      std::latch               start(thread_count);
+      std::vector<std::thread> workers;
+      workers.reserve(thread_count);
+
+      for (auto& state : states) {
+        workers.emplace_back([&benchmark, &start, &state]() {
+          start.arrive_and_wait();
+          benchmark.function_(state);
+        });
+      }
+
+      for (auto& worker : workers) {
+        worker.join();
+      }
+    }
+
+    if (benchmark.teardown_) {
+      benchmark.teardown_(State(arg, 0U, thread_count, iterations));
+    }
+
+    /* The slowest thread determines the run time of a contended benchmark */
+    Result result{.iterations = iterations};
+    for (const auto& state : states) {
+      result.seconds  = std::max(result.seconds, std::chrono::duration<double>(state.Elapsed()).count());
+      result.items   += state.ItemsProcessed();
+    }
+
+    return result;
+  }
+
+  static void Report(const std::string& name, const Result& result) {
+    double ns_per_iteration = 1e9 * result.seconds / static_cast<double>(result.iterations);
+
+    std::printf("%-64s %14.2f ns %14llu", name.c_str(), ns_per_iteration,
+                static_cast<unsigned long long>(result.iterations));
+
+    if (result.items > 0 && result.seconds > 0.0) {
+      std::printf(" %12.3f M items/s", 1e-6 * static_cast<double>(result.items) / result.seconds);
+    }
+
+    std::printf("\n");
+    std::fflush(stdout);
+  }
+
+  double min_time_s_;
+};
+
+int RunBenchmarks(int argc, char** argv) {
+  std::string_view filter;
+  double           min_time_s = 0.5;
+  bool             list_only  = false;
+
+  for (int arg_idx = 1; arg_idx < argc; ++arg_idx) {
+    std::string_view arg{argv[arg_idx]};
+
+    if (arg == "--list") {
+      list_only = true;
+    } else if (arg == "--filter" && arg_idx + 1 < argc) {
+      filter = argv[++arg_idx];
+    } else if (arg == "--min-time" && arg_idx + 1 < argc) {
+      min_time_s = std::atof(argv[++arg_idx]);
+    } else {
+      std::fprintf(stderr, "Usage: %s [--filter <substring>] [--min-time <seconds>] [--list]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  auto& benchmarks = Registry();
+  std::sort(benchmarks.begin(), benchmarks.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs->Name() < rhs->Name(); });
+
+  if (!list_only) {
+    std::printf("%-64s %17s %14s\n", "Benchmark", "Time", "Iterations");
+    std::printf("%s\n", std::string(112, '-').c_str());
+  }
+
+  Runner runner(min_time_s);
+  for (const auto& benchmark : benchmarks) {
+    if (benchmark->Name().find(filter) == std::string::npos) {
+      continue;
+    }
+
+    if (list_only) {
+      std::printf("%s\n", benchmark->Name().c_str());
+    } else {
+      runner.Run(*benchmark);
+    }
+  }
+
+  return 0;
+}
+
+}  // namespace liger::microbench
@@ -0,0 +1,194 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file Benchmark.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace liger::microbench {
+
+/**
+ * @brief Per-thread state of a single benchmark run, the measured code is run in a loop over it:
+ * @code
+ * void BM_Something(State& state) {
+ *   // Setup, not measured
+ *   for (auto _ : state) {
+ *     // Measured code
+ *   }
+ * }
+ * @endcode
+ */
+class State {
+ public:
+  struct [[maybe_unused]] Iteration {};
+
+  class Iterator {
+   public:
+    Iteration operator*() const { return {}; }
+    void operator++() { --remaining_; }
+    bool operator!=(const Iterator&) {
+      if (remaining_ != 0U) {
+        return true;
+      }
+
+      state_->PauseTiming();
+      return false;
+    }
+
+   private:
+    Iterator(State* state, uint64_t remaining) : state_(state), remaining_(remaining) {}
+
+    State*   state_;
+    uint64_t remaining_;
+
+    friend class State;
+  };
+
+  State(int64_t arg, uint32_t thread_idx, uint32_t thread_count, uint64_t iterations);
+
+  Iterator begin();
+  Iterator end();
+
+  int64_t  Arg() const;
+  uint32_t ThreadIndex() const;
+  uint32_t ThreadCount() const;
+  uint64_t Iterations() const;
+
+  /**
+   * @brief Exclude the following code from the measurement, e.g. per-iteration setup.
+   */
+  void PauseTiming();
+  void ResumeTiming();
+
+  /**
+   * @brief Number of processed items, used to report the throughput.
+   */
+  void SetItemsProcessed(int64_t items);
+  int64_t ItemsProcessed() const;
+
+  std::chrono::nanoseconds Elapsed() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  int64_t                  arg_;
+  uint32_t                 thread_idx_;
+  uint32_t                 thread_count_;
+  uint64_t                 iterations_;
+  int64_t                  items_processed_{0};
+
+  bool                     running_{false};
+  Clock::time_point        start_;
+  std::chrono::nanoseconds elapsed_{0};
+};
+
+using BenchmarkFunction = void (*)(State& state);
+using FixtureFunction   = void (*)(const State& state);
+
+/**
+ * @brief Benchmark registration, configured by chaining, e.g. `->Range(1, 100'000)->Threads(4)`.
+ */
+class Benchmark {
+ public:
+  Benchmark(std::string name, BenchmarkFunction function);
+
+  Benchmark* Arg(int64_t arg);
+
+  /**
+   * @brief Add arguments from @p start to @p limit (inclusive) multiplying by @p multiplier.
+   */
+  Benchmark* Range(int64_t start, int64_t limit, int64_t multiplier = 10);
+
+  /**
+   * @brief Run the benchmark on @p threads threads simultaneously, can be specified several times.
+   */
+  Benchmark* Threads(uint32_t threads);
+
+  /**
+   * @brief Called once per run before the threads are started, e.g. to create state shared by the threads.
+   */
+  Benchmark* Setup(FixtureFunction setup);
+  Benchmark* Teardown(FixtureFunction teardown);
+
+  const std::string& Name() const;
+
+ private:
+  std::string           name_;
+  BenchmarkFunction     function_;
+  FixtureFunction       setup_{nullptr};
+  FixtureFunction       teardown_{nullptr};
+  std::vector<int64_t>  args_;
+  std::vector<uint32_t> threads_;
+
+  friend class Runner;
+};
+
+Benchmark* RegisterBenchmark(std::string name, BenchmarkFunction function);
+
+/**
+ * @brief Run the registered benchmarks and print the results.
+ *
+ * Supported arguments: --filter <substring>, --min-time <seconds>, --list.
+ */
+int RunBenchmarks(int argc, char** argv);
+
+/**
+ * @brief Prevent the compiler from optimizing away the computation of @p value.
+ */
+template <typename T>
+inline void DoNotOptimize(T&& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/**
+ * @brief Force pending memory writes to be considered observable.
+ */
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+}  // namespace liger::microbench
+
+#define LIGER_MICROBENCH_CONCAT_IMPL(a, b) a##b
+#define LIGER_MICROBENCH_CONCAT(a, b)      LIGER_MICROBENCH_CONCAT_IMPL(a, b)
+
+#define LIGER_MICROBENCHMARK(function)                                                 \
+  [[maybe_unused]] static ::liger::microbench::Benchmark* LIGER_MICROBENCH_CONCAT(     \
+      kMicrobenchmark, __LINE__) = ::liger::microbench::RegisterBenchmark(#function, function)
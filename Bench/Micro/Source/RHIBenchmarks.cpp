@@ -0,0 +1,207 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file RHIBenchmarks.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Harness/Benchmark.hpp"
+
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
+#include <Liger-Engine/RHI/Context.hpp>
+#include <Liger-Engine/RHI/ResourceVersionRegistry.hpp>
+
+#include <array>
+#include <random>
+
+namespace liger::microbench {
+
+namespace {
+
+constexpr int64_t  kMinSize  = 1;
+constexpr int64_t  kMaxSize  = 100'000;
+constexpr uint32_t kRandSeed = 42U;
+
+/************************************************************************************************
+ * ResourceVersionRegistry
+ ************************************************************************************************/
+struct FakeTexture {
+  void*    texture;
+  uint32_t view;
+};
+
+using FakeBuffer = void*;
+using Registry   = rhi::ResourceVersionRegistry<FakeTexture, FakeBuffer>;
+
+/* A render graph resource typically goes through a few versions, one per pass writing it */
+constexpr uint32_t kVersionsPerResource = 3U;
+
+Registry MakeRegistry(uint32_t size) {
+  Registry registry;
+  for (uint32_t resource_idx = 0U; resource_idx < size; ++resource_idx) {
+    auto version = (resource_idx % 2U == 0U) ? registry.AddResource(FakeTexture{})
+                                             : registry.AddResource(FakeBuffer{});
+    for (uint32_t version_idx = 1U; version_idx < kVersionsPerResource; ++version_idx) {
+      version = registry.NextVersion(version);
+    }
+  }
+
+  return registry;
+}
+
+void BM_ResourceVersionRegistryBuild(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  for (auto _ : state) {
+    auto registry = MakeRegistry(size);
+    DoNotOptimize(registry);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_ResourceVersionRegistryBuild)->Range(kMinSize, kMaxSize);
+
+void BM_ResourceVersionRegistryLookup(State& state) {
+  const auto size     = static_cast<uint32_t>(state.Arg());
+  auto       registry = MakeRegistry(size);
+
+  std::mt19937                            generator(kRandSeed);
+  std::uniform_int_distribution<uint32_t> version_distribution(0U, registry.GetVersionsCount() - 1U);
+
+  std::vector<Registry::ResourceVersion> versions(4096U);
+  for (auto& version : versions) {
+    version = version_distribution(generator);
+  }
+
+  size_t version_idx = 0U;
+  for (auto _ : state) {
+    DoNotOptimize(registry.TryGetResourceByVersion<FakeTexture>(versions[version_idx]));
+    version_idx = (version_idx + 1U) % versions.size();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_ResourceVersionRegistryLookup)->Range(kMinSize, kMaxSize);
+
+/************************************************************************************************
+ * rhi::Context
+ ************************************************************************************************/
+template <size_t I>
+struct ContextData {
+  uint64_t value{I};
+};
+
+template <size_t... Is>
+void InsertAll(rhi::Context& context, std::index_sequence<Is...>) {
+  (context.Insert(ContextData<Is>{}), ...);
+}
+
+template <size_t... Is>
+uint64_t GetAll(rhi::Context& context, std::index_sequence<Is...>) {
+  return (context.Get<ContextData<Is>>().value + ...);
+}
+
+constexpr size_t kContextDataTypes = 16U;
+
+void BM_ContextGet(State& state) {
+  rhi::Context context;
+  InsertAll(context, std::make_index_sequence<kContextDataTypes>());
+
+  for (auto _ : state) {
+    DoNotOptimize(GetAll(context, std::make_index_sequence<kContextDataTypes>()));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * kContextDataTypes));
+}
+LIGER_MICROBENCHMARK(BM_ContextGet);
+
+template <size_t... Is>
+uint64_t GetAllBySlot(rhi::Context& context, const std::array<TypeSlotId, sizeof...(Is)>& slots,
+                      std::index_sequence<Is...>) {
+  return (context.Get<ContextData<Is>>(slots[Is]).value + ...);
+}
+
+/* Slots resolved once, as render graph jobs can do when they are set up */
+void BM_ContextGetCachedSlot(State& state) {
+  rhi::Context context;
+  InsertAll(context, std::make_index_sequence<kContextDataTypes>());
+
+  const auto slots = []<size_t... Is>(std::index_sequence<Is...>) {
+    return std::array<TypeSlotId, sizeof...(Is)>{rhi::Context::Slot<ContextData<Is>>()...};
+  }(std::make_index_sequence<kContextDataTypes>());
+
+  for (auto _ : state) {
+    DoNotOptimize(GetAllBySlot(context, slots, std::make_index_sequence<kContextDataTypes>()));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * kContextDataTypes));
+}
+LIGER_MICROBENCHMARK(BM_ContextGetCachedSlot);
+
+/* Features re-insert their per-frame data every frame, which assigns over the existing entries */
+void BM_ContextReinsert(State& state) {
+  rhi::Context context;
+  InsertAll(context, std::make_index_sequence<kContextDataTypes>());
+
+  for (auto _ : state) {
+    InsertAll(context, std::make_index_sequence<kContextDataTypes>());
+    ClobberMemory();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * kContextDataTypes));
+}
+LIGER_MICROBENCHMARK(BM_ContextReinsert);
+
+/************************************************************************************************
+ * Descriptor free lists
+ ************************************************************************************************/
+/* Same limit and free list policy as VulkanDescriptorManager, which can not be created without a device */
+constexpr uint32_t kMaxBindlessResourcesPerType = 2048U;
+
+void BM_DescriptorFreeListAcquireRelease(State& state) {
+  const auto size = static_cast<uint32_t>(state.Arg());
+
+  FreeList free_bindings(kMaxBindlessResourcesPerType, FreeListPolicy::LowestIndexFirst);
+
+  std::vector<uint32_t> acquired;
+  acquired.reserve(size);
+
+  for (auto _ : state) {
+    for (uint32_t binding_idx = 0U; binding_idx < size; ++binding_idx) {
+      acquired.push_back(free_bindings.Allocate());
+    }
+
+    for (auto binding : acquired) {
+      free_bindings.Free(binding);
+    }
+
+    acquired.clear();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_DescriptorFreeListAcquireRelease)->Range(kMinSize, kMaxBindlessResourcesPerType, 8);
+
+}  // namespace
+
+}  // namespace liger::microbench
@@ -0,0 +1,70 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file UUIDBenchmarks.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Harness/Benchmark.hpp"
+
+#include <Liger-Engine/Core/UUID.hpp>
+
+#include <vector>
+
+namespace liger::microbench {
+
+namespace {
+
+/************************************************************************************************
+ * UUID
+ ************************************************************************************************/
+void BM_UUIDGenerate(State& state) {
+  for (auto _ : state) {
+    DoNotOptimize(UUID::Generate());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations()));
+}
+LIGER_MICROBENCHMARK(BM_UUIDGenerate)
+    ->Threads(1U)
+    ->Threads(2U)
+    ->Threads(4U)
+    ->Threads(8U);
+
+void BM_UUIDGenerateN(State& state) {
+  const auto size = static_cast<size_t>(state.Arg());
+
+  std::vector<UUID> uuids(size);
+
+  for (auto _ : state) {
+    UUID::GenerateN(uuids);
+    ClobberMemory();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.Iterations() * size));
+}
+LIGER_MICROBENCHMARK(BM_UUIDGenerateN)->Range(1, 100'000);
+
+}  // namespace
+
+}  // namespace liger::microbench
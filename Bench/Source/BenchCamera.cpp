@@ -0,0 +1,119 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchCamera.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BenchCamera.hpp"
+
+namespace liger::bench {
+
+BenchCamera::BenchCamera(glm::vec3 orbit_center, float orbit_radius)
+    : orbit_center_(orbit_center), orbit_radius_(orbit_radius) {}
+
+void BenchCamera::ListenTo(EventDispatcher& dispatcher) {
+  replay_ = true;
+
+  dispatcher.GetSink<KeyEvent>().Connect<&BenchCamera::OnKey>(*this);
+  dispatcher.GetSink<MouseMoveEvent>().Connect<&BenchCamera::OnMouseMove>(*this);
+  dispatcher.GetSink<MouseButtonEvent>().Connect<&BenchCamera::OnMouseButton>(*this);
+}
+
+void BenchCamera::Update(ecs::WorldTransform& transform, float dt) {
+  if (!replay_) {
+    orbit_angle_ += kOrbitSpeed * dt;
+
+    glm::vec3 offset{orbit_radius_ * glm::sin(orbit_angle_), kOrbitHeight * orbit_radius_,
+                     orbit_radius_ * glm::cos(orbit_angle_)};
+
+    transform.position = orbit_center_ + offset;
+    transform.rotation = glm::quatLookAt(glm::normalize(-offset), ecs::WorldTransform::kUp);
+    return;
+  }
+
+  glm::vec3 forward = transform.Forward();
+  glm::vec3 right   = transform.Right();
+  glm::vec3 up      = transform.Up();
+
+  float disp = kSpeed * dt;
+
+  if (KeyPressed(Key::W)) {
+    transform.position += disp * forward;
+  } else if (KeyPressed(Key::S)) {
+    transform.position -= disp * forward;
+  }
+
+  if (KeyPressed(Key::D)) {
+    transform.position += disp * right;
+  } else if (KeyPressed(Key::A)) {
+    transform.position -= disp * right;
+  }
+
+  if (KeyPressed(Key::E)) {
+    transform.position += 0.5f * disp * up;
+  } else if (KeyPressed(Key::Q)) {
+    transform.position -= 0.5f * disp * up;
+  }
+
+  transform.rotation = glm::quat(glm::vec3(rotation_z_, rotation_y_, 0));
+}
+
+bool BenchCamera::OnKey(const KeyEvent& key) {
+  auto key_idx = static_cast<size_t>(key.key);
+  if (key_idx < pressed_keys_.size()) {
+    pressed_keys_[key_idx] = (key.action != PressAction::Release);
+  }
+
+  return true;
+}
+
+bool BenchCamera::OnMouseMove(const MouseMoveEvent& mouse_move) {
+  if (!rotation_mode_) {
+    return true;
+  }
+
+  rotation_y_ -= 0.001f * mouse_move.delta.x;
+  rotation_z_ -= 0.001f * mouse_move.delta.y;
+
+  return true;
+}
+
+bool BenchCamera::OnMouseButton(const MouseButtonEvent& mouse_button) {
+  if (mouse_button.button == MouseButton::Right) {
+    if (mouse_button.action == PressAction::Press) {
+      rotation_mode_ = true;
+    } else if (mouse_button.action == PressAction::Release) {
+      rotation_mode_ = false;
+    }
+  }
+
+  return true;
+}
+
+bool BenchCamera::KeyPressed(Key key) const {
+  auto key_idx = static_cast<size_t>(key);
+  return key_idx < pressed_keys_.size() && pressed_keys_[key_idx];
+}
+
+}  // namespace liger::bench
@@ -0,0 +1,76 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchCamera.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Event/EventDispatcher.hpp>
+#include <Liger-Engine/Core/Platform/Keyboard.hpp>
+#include <Liger-Engine/Core/Platform/Mouse.hpp>
+#include <Liger-Engine/ECS/DefaultComponents.hpp>
+
+#include <bitset>
+
+namespace liger::bench {
+
+/**
+ * @brief Camera controller of the benchmark scene.
+ *
+ * When input is replayed, it moves like @ref ecs::CameraMovementScript, but reads the input from the
+ * dispatcher instead of the platform layer, as there is no window. Otherwise it follows a fixed orbit,
+ * so that every run renders the same sequence of views.
+ */
+class BenchCamera {
+ public:
+  BenchCamera(glm::vec3 orbit_center, float orbit_radius);
+
+  void ListenTo(EventDispatcher& dispatcher);
+
+  void Update(ecs::WorldTransform& transform, float dt);
+
+ private:
+  static constexpr float kSpeed       = 10.0f;
+  static constexpr float kOrbitSpeed  = 0.2f;
+  static constexpr float kOrbitHeight = 0.35f;
+
+  bool OnKey(const KeyEvent& key);
+  bool OnMouseMove(const MouseMoveEvent& mouse_move);
+  bool OnMouseButton(const MouseButtonEvent& mouse_button);
+
+  bool KeyPressed(Key key) const;
+
+  glm::vec3                      orbit_center_;
+  float                          orbit_radius_;
+  float                          orbit_angle_{0.0f};
+
+  bool                           replay_{false};
+  bool                           rotation_mode_{false};
+  float                          rotation_y_{0.0f};
+  float                          rotation_z_{0.0f};
+  std::bitset<GLFW_KEY_LAST + 1> pressed_keys_;
+};
+
+}  // namespace liger::bench
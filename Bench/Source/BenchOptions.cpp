@@ -0,0 +1,154 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchOptions.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BenchOptions.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <string_view>
+
+namespace liger::bench {
+
+namespace {
+
+constexpr const char* kUsage =
+    "Usage: liger-bench --registry <file> (--mesh <file> | --scene <file>) [options]\n"
+    "\n"
+    "  --registry <file>     Asset registry file containing the engine and scene assets\n"
+    "  --mesh <file>         Static mesh asset (relative to the registry) instanced over the grid\n"
+    "  --scene <file>        Scene file (.lscene) to load instead of generating the mesh grid\n"
+    "  --save-scene <file>   Save the generated scene to the file\n"
+    "  --grid <n>            Mesh grid size, n x n instances (default 16)\n"
+    "  --spacing <f>         Distance between grid instances (default 4.0)\n"
+    "  --lights <n>          Number of point lights (default 128)\n"
+    "  --warmup <n>          Frames run before measuring (default 60)\n"
+    "  --frames <n>          Measured frames (default 600)\n"
+    "  --timestep <f>        Fixed simulation timestep in seconds (default 1/60)\n"
+    "  --width <n>           Render target width (default 1920)\n"
+    "  --height <n>          Render target height (default 1080)\n"
+    "  --device <id>         Device id, the first supported one is used by default\n"
+    "  --replay <file>       Input recording driving the camera\n"
+    "  --output <file>       Write the JSON report to the file instead of stdout\n"
+    "  --check-allocations   Fail if steady-state frames allocate (needs LIGER_TRACK_ALLOCATIONS)\n"
+    "  --no-pipelining       Do not overlap simulation of the next frame with rendering of the current one\n";
+
+template <typename T>
+bool ParseNumber(std::string_view str, T& value) {
+  const auto* end    = str.data() + str.size();
+  auto        result = std::from_chars(str.data(), end, value);
+  return result.ec == std::errc() && result.ptr == end;
+}
+
+}  // namespace
+
+std::optional<BenchOptions> ParseOptions(int argc, char** argv) {
+  BenchOptions options;
+
+  bool valid = true;
+  for (int arg_idx = 1; arg_idx < argc && valid; ++arg_idx) {
+    std::string_view arg{argv[arg_idx]};
+
+    if (arg == "--check-allocations") {
+      options.check_allocations = true;
+      continue;
+    }
+
+    if (arg == "--no-pipelining") {
+      options.pipelined = false;
+      continue;
+    }
+
+    if (arg_idx + 1 >= argc) {
+      std::fprintf(stderr, "Missing value for '%s'\n", argv[arg_idx]);
+      valid = false;
+      break;
+    }
+
+    std::string_view value{argv[++arg_idx]};
+
+    if (arg == "--registry") {
+      options.registry_file = value;
+    } else if (arg == "--mesh") {
+      options.mesh_file = value;
+    } else if (arg == "--scene") {
+      options.scene_file = value;
+    } else if (arg == "--save-scene") {
+      options.save_scene_file = value;
+    } else if (arg == "--replay") {
+      options.replay_file = value;
+    } else if (arg == "--output") {
+      options.output_file = value;
+    } else if (arg == "--device") {
+      uint32_t device_id = 0U;
+      valid = ParseNumber(value, device_id);
+      options.device_id = device_id;
+    } else if (arg == "--grid") {
+      valid = ParseNumber(value, options.grid_size);
+    } else if (arg == "--spacing") {
+      valid = ParseNumber(value, options.grid_spacing);
+    } else if (arg == "--lights") {
+      valid = ParseNumber(value, options.light_count);
+    } else if (arg == "--warmup") {
+      valid = ParseNumber(value, options.warmup_frames);
+    } else if (arg == "--frames") {
+      valid = ParseNumber(value, options.measured_frames) && options.measured_frames > 0U;
+    } else if (arg == "--timestep") {
+      valid = ParseNumber(value, options.timestep) && options.timestep > 0.0f;
+    } else if (arg == "--width") {
+      valid = ParseNumber(value, options.width) && options.width > 0U;
+    } else if (arg == "--height") {
+      valid = ParseNumber(value, options.height) && options.height > 0U;
+    } else {
+      std::fprintf(stderr, "Unknown argument '%s'\n", argv[arg_idx - 1]);
+      valid = false;
+      break;
+    }
+
+    if (!valid) {
+      std::fprintf(stderr, "Invalid value '%s' for '%s'\n", argv[arg_idx], argv[arg_idx - 1]);
+    }
+  }
+
+  if (valid && (options.registry_file.empty() || (options.mesh_file.empty() && !options.scene_file))) {
+    std::fprintf(stderr, "Both --registry and either --mesh or --scene must be specified\n");
+    valid = false;
+  }
+
+  if (valid && options.scene_file && options.save_scene_file) {
+    std::fprintf(stderr, "Only a generated scene can be saved, --scene and --save-scene are exclusive\n");
+    valid = false;
+  }
+
+  if (!valid) {
+    std::fprintf(stderr, "%s", kUsage);
+    return std::nullopt;
+  }
+
+  return options;
+}
+
+}  // namespace liger::bench
@@ -0,0 +1,67 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchOptions.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace liger::bench {
+
+struct BenchOptions {
+  std::filesystem::path                registry_file;
+  std::filesystem::path                mesh_file;
+  std::optional<std::filesystem::path> scene_file;
+  std::optional<std::filesystem::path> save_scene_file;
+  std::optional<std::filesystem::path> replay_file;
+  std::optional<std::filesystem::path> output_file;
+  std::optional<uint32_t>              device_id;
+
+  uint32_t                             grid_size{16U};
+  float                                grid_spacing{4.0f};
+  uint32_t                             light_count{128U};
+
+  uint32_t                             warmup_frames{60U};
+  uint32_t                             measured_frames{600U};
+  float                                timestep{1.0f / 60.0f};
+
+  uint32_t                             width{1920U};
+  uint32_t                             height{1080U};
+
+  bool                                 check_allocations{false};
+  bool                                 pipelined{true};
+};
+
+/**
+ * @brief Parse command line arguments.
+ *
+ * @return Options or std::nullopt if the arguments are invalid, in which case the usage is printed.
+ */
+std::optional<BenchOptions> ParseOptions(int argc, char** argv);
+
+}  // namespace liger::bench
@@ -0,0 +1,258 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchReport.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BenchReport.hpp"
+
+#include <Liger-Engine/Core/EnumReflection.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace liger::bench {
+
+namespace {
+
+std::string EscapeJson(std::string_view str) {
+  std::string escaped;
+  escaped.reserve(str.size());
+
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(c);
+  }
+
+  return escaped;
+}
+
+/* Nearest-rank percentile, the same method FrameTimer uses */
+float Percentile(const std::vector<float>& sorted, float percent) {
+  auto rank = static_cast<size_t>(std::ceil(percent / 100.0f * static_cast<float>(sorted.size())));
+  return sorted[std::clamp<size_t>(rank, 1U, sorted.size()) - 1U];
+}
+
+void AppendStatistics(std::string& json, const FrameTimer::Statistics& statistics) {
+  fmt::format_to(std::back_inserter(json),
+                 "{{\"p50\": {:.4f}, \"p95\": {:.4f}, \"p99\": {:.4f}, \"max\": {:.4f}, \"mean\": {:.4f}}}",
+                 statistics.p50_ms, statistics.p95_ms, statistics.p99_ms, statistics.max_ms, statistics.mean_ms);
+}
+
+}  // namespace
+
+void BenchReport::SetDeviceName(std::string_view device_name) { device_name_ = device_name; }
+
+void BenchReport::SetLoadTimeMs(float load_time_ms) { load_time_ms_ = load_time_ms; }
+
+void BenchReport::SetCpuFrameStatistics(const FrameTimer::Statistics& statistics) { cpu_statistics_ = statistics; }
+
+void BenchReport::SetMemoryUsage(uint64_t peak_rss_bytes, const rhi::IDevice::MemoryUsage& gpu_memory) {
+  peak_rss_bytes_ = peak_rss_bytes;
+  gpu_memory_     = gpu_memory;
+}
+
+void BenchReport::SetResolution(uint32_t width, uint32_t height) {
+  width_  = width;
+  height_ = height;
+}
+
+void BenchReport::SetWarmupFrames(uint32_t warmup_frames) { warmup_frames_ = warmup_frames; }
+
+void BenchReport::SetCriticalPath(const FrameTaskGraph& frame_graph) {
+  critical_path_.clear();
+
+  for (auto task : frame_graph.CriticalPath()) {
+    const auto& timing = frame_graph.LastTiming(task);
+    critical_path_.emplace_back(CriticalTask{
+      .name        = std::string(frame_graph.TaskName(task)),
+      .begin_ms    = timing.begin_ms,
+      .duration_ms = timing.duration_ms,
+      .worker      = timing.worker
+    });
+  }
+}
+
+void BenchReport::AddHitch() { ++hitch_count_; }
+
+void BenchReport::AddPhaseTimes(const FrameTimer& frame_timer) {
+  for (uint32_t phase_idx = 0U; phase_idx < kFramePhaseCount; ++phase_idx) {
+    phase_totals_ms_[phase_idx] += frame_timer.PhaseTimeMs(static_cast<FramePhase>(phase_idx));
+  }
+
+  ++phase_frame_count_;
+}
+
+void BenchReport::AddRenderStats(std::span<const render::Renderer::FeatureStats> feature_stats,
+                                 float execute_time_ms, std::optional<float> gpu_time_ms) {
+  if (feature_totals_.empty()) {
+    for (const auto& stats : feature_stats) {
+      feature_totals_.emplace_back(FeatureTotals{.name = std::string(stats.name)});
+    }
+  }
+
+  for (size_t feature_idx = 0U; feature_idx < feature_stats.size(); ++feature_idx) {
+    feature_totals_[feature_idx].pre_render_ms  += feature_stats[feature_idx].pre_render_ms;
+    feature_totals_[feature_idx].post_render_ms += feature_stats[feature_idx].post_render_ms;
+  }
+
+  execute_total_ms_ += execute_time_ms;
+  ++render_frame_count_;
+
+  if (gpu_time_ms) {
+    gpu_times_ms_.push_back(*gpu_time_ms);
+  }
+}
+
+void BenchReport::SetSystemStats(std::span<const ecs::SystemGraph::SystemStats> system_stats) {
+  system_totals_.clear();
+
+  for (const auto& stats : system_stats) {
+    system_totals_.emplace_back(SystemTotals{
+      .name       = std::string(stats.name),
+      .mean_ms    = stats.run_count > 0U ? stats.total_ms / static_cast<double>(stats.run_count) : 0.0,
+      .run_count  = stats.run_count,
+      .skip_count = stats.skip_count
+    });
+  }
+}
+
+std::string BenchReport::ToJson() const {
+  std::string json;
+  auto out = std::back_inserter(json);
+
+  fmt::format_to(out, "{{\n");
+  fmt::format_to(out, "  \"device\": \"{}\",\n", EscapeJson(device_name_));
+  fmt::format_to(out, "  \"resolution\": [{}, {}],\n", width_, height_);
+  fmt::format_to(out, "  \"warmup_frames\": {},\n", warmup_frames_);
+  fmt::format_to(out, "  \"frames\": {},\n", cpu_statistics_.frame_count);
+  fmt::format_to(out, "  \"load_time_ms\": {:.4f},\n", load_time_ms_);
+
+  fmt::format_to(out, "  \"cpu_frame_ms\": ");
+  AppendStatistics(json, cpu_statistics_);
+  fmt::format_to(out, ",\n");
+
+  fmt::format_to(out, "  \"gpu_frame_ms\": ");
+  if (gpu_times_ms_.empty()) {
+    fmt::format_to(out, "null");
+  } else {
+    auto sorted = gpu_times_ms_;
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+    for (float time : sorted) {
+      total += time;
+    }
+
+    AppendStatistics(json, FrameTimer::Statistics{
+      .p50_ms      = Percentile(sorted, 50.0f),
+      .p95_ms      = Percentile(sorted, 95.0f),
+      .p99_ms      = Percentile(sorted, 99.0f),
+      .max_ms      = sorted.back(),
+      .mean_ms     = static_cast<float>(total / static_cast<double>(sorted.size())),
+      .frame_count = static_cast<uint32_t>(sorted.size())
+    });
+  }
+  fmt::format_to(out, ",\n");
+
+  fmt::format_to(out, "  \"hitches\": {},\n", hitch_count_);
+
+  fmt::format_to(out, "  \"phase_mean_ms\": {{");
+  for (uint32_t phase_idx = 0U; phase_idx < kFramePhaseCount; ++phase_idx) {
+    double mean = phase_frame_count_ > 0U ? phase_totals_ms_[phase_idx] / phase_frame_count_ : 0.0;
+    fmt::format_to(out, "{}\"{}\": {:.4f}", phase_idx > 0U ? ", " : "",
+                   EnumToString(static_cast<FramePhase>(phase_idx)), mean);
+  }
+  fmt::format_to(out, "}},\n");
+
+  const double render_frames = std::max(render_frame_count_, 1U);
+
+  fmt::format_to(out, "  \"render_graph_execute_mean_ms\": {:.4f},\n", execute_total_ms_ / render_frames);
+  fmt::format_to(out, "  \"features\": [");
+  for (size_t feature_idx = 0U; feature_idx < feature_totals_.size(); ++feature_idx) {
+    const auto& feature = feature_totals_[feature_idx];
+    fmt::format_to(out, "{}\n    {{\"name\": \"{}\", \"pre_render_mean_ms\": {:.4f}, \"post_render_mean_ms\": {:.4f}}}",
+                   feature_idx > 0U ? "," : "", EscapeJson(feature.name), feature.pre_render_ms / render_frames,
+                   feature.post_render_ms / render_frames);
+  }
+  fmt::format_to(out, "{}],\n", feature_totals_.empty() ? "" : "\n  ");
+
+  fmt::format_to(out, "  \"systems\": [");
+  for (size_t system_idx = 0U; system_idx < system_totals_.size(); ++system_idx) {
+    const auto& system = system_totals_[system_idx];
+    fmt::format_to(out, "{}\n    {{\"name\": \"{}\", \"mean_ms\": {:.4f}, \"runs\": {}, \"skips\": {}}}",
+                   system_idx > 0U ? "," : "", EscapeJson(system.name), system.mean_ms, system.run_count,
+                   system.skip_count);
+  }
+  fmt::format_to(out, "{}],\n", system_totals_.empty() ? "" : "\n  ");
+
+  fmt::format_to(out, "  \"last_frame_critical_path\": [");
+  for (size_t task_idx = 0U; task_idx < critical_path_.size(); ++task_idx) {
+    const auto& task = critical_path_[task_idx];
+    fmt::format_to(out, "{}\n    {{\"task\": \"{}\", \"begin_ms\": {:.4f}, \"duration_ms\": {:.4f}, \"worker\": {}}}",
+                   task_idx > 0U ? "," : "", EscapeJson(task.name), task.begin_ms, task.duration_ms, task.worker);
+  }
+  fmt::format_to(out, "{}],\n", critical_path_.empty() ? "" : "\n  ");
+
+  fmt::format_to(out, "  \"memory\": {{\"peak_rss_bytes\": {}, \"gpu_used_bytes\": {}, \"gpu_budget_bytes\": {}}}\n",
+                 peak_rss_bytes_, gpu_memory_.used_bytes, gpu_memory_.budget_bytes);
+  fmt::format_to(out, "}}\n");
+
+  return json;
+}
+
+uint64_t PeakResidentSetBytes() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return counters.PeakWorkingSetSize;
+  }
+  return 0U;
+#else
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0U;
+  }
+
+#if defined(__APPLE__)
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  /* Reported in kilobytes on Linux */
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024U;
+#endif
+#endif
+}
+
+}  // namespace liger::bench
@@ -0,0 +1,122 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file BenchReport.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Task/FrameTaskGraph.hpp>
+#include <Liger-Engine/Core/Time.hpp>
+#include <Liger-Engine/RHI/Device.hpp>
+#include <Liger-Engine/Render/Renderer.hpp>
+
+#include <array>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace liger::bench {
+
+/**
+ * @brief Accumulates per-frame measurements and serializes the results to JSON.
+ */
+class BenchReport {
+ public:
+  void SetDeviceName(std::string_view device_name);
+  void SetLoadTimeMs(float load_time_ms);
+  void SetCpuFrameStatistics(const FrameTimer::Statistics& statistics);
+  void SetMemoryUsage(uint64_t peak_rss_bytes, const rhi::IDevice::MemoryUsage& gpu_memory);
+  void SetResolution(uint32_t width, uint32_t height);
+  void SetWarmupFrames(uint32_t warmup_frames);
+
+  /**
+   * @brief Record the critical path of the last frame run by the graph.
+   */
+  void SetCriticalPath(const FrameTaskGraph& frame_graph);
+
+  void AddHitch();
+  void AddPhaseTimes(const FrameTimer& frame_timer);
+  void AddRenderStats(std::span<const render::Renderer::FeatureStats> feature_stats, float execute_time_ms,
+                      std::optional<float> gpu_time_ms);
+
+  /**
+   * @brief Record the entity systems' timings accumulated over all frames.
+   */
+  void SetSystemStats(std::span<const ecs::SystemGraph::SystemStats> system_stats);
+
+  std::string ToJson() const;
+
+ private:
+  struct CriticalTask {
+    std::string name;
+    float       begin_ms{0.0f};
+    float       duration_ms{0.0f};
+    int32_t     worker{-1};
+  };
+
+  struct SystemTotals {
+    std::string name;
+    double      mean_ms{0.0};
+    uint64_t    run_count{0U};
+    uint64_t    skip_count{0U};
+  };
+
+  struct FeatureTotals {
+    std::string name;
+    double      pre_render_ms{0.0};
+    double      post_render_ms{0.0};
+  };
+
+  std::string                          device_name_;
+  float                                load_time_ms_{0.0f};
+  FrameTimer::Statistics               cpu_statistics_;
+  uint32_t                             width_{0U};
+  uint32_t                             height_{0U};
+  uint32_t                             warmup_frames_{0U};
+  uint32_t                             hitch_count_{0U};
+
+  uint64_t                             peak_rss_bytes_{0U};
+  rhi::IDevice::MemoryUsage            gpu_memory_;
+
+  std::array<double, kFramePhaseCount> phase_totals_ms_{};
+  uint32_t                             phase_frame_count_{0U};
+
+  std::vector<FeatureTotals>           feature_totals_;
+  double                               execute_total_ms_{0.0};
+  uint32_t                             render_frame_count_{0U};
+  std::vector<float>                   gpu_times_ms_;
+
+  std::vector<SystemTotals>            system_totals_;
+
+  std::vector<CriticalTask>            critical_path_;
+};
+
+/**
+ * @brief Peak resident set size of the process in bytes, or 0 if it is unknown on the platform.
+ */
+uint64_t PeakResidentSetBytes();
+
+}  // namespace liger::bench
@@ -0,0 +1,414 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file LigerBench.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BenchCamera.hpp"
+#include "BenchOptions.hpp"
+#include "BenchReport.hpp"
+
+#include <Liger-Engine/Asset/Loaders/MaterialLoader.hpp>
+#include <Liger-Engine/Asset/Loaders/ShaderLoader.hpp>
+#include <Liger-Engine/Asset/Loaders/StaticMeshLoader.hpp>
+#include <Liger-Engine/Asset/Loaders/TextureLoader.hpp>
+#include <Liger-Engine/Asset/Manager.hpp>
+#include <Liger-Engine/Core/Memory/AllocationTracker.hpp>
+#include <Liger-Engine/Core/Platform/InputRecording.hpp>
+#include <Liger-Engine/Core/Task/FrameTaskGraph.hpp>
+#include <Liger-Engine/ECS/Scene.hpp>
+#include <Liger-Engine/ECS/SceneFormat.hpp>
+#include <Liger-Engine/RHI/Instance.hpp>
+#include <Liger-Engine/Render/BuiltIn/BloomFeature.hpp>
+#include <Liger-Engine/Render/BuiltIn/CameraDataCollector.hpp>
+#include <Liger-Engine/Render/BuiltIn/ClusteredLightFeature.hpp>
+#include <Liger-Engine/Render/BuiltIn/ForwardRenderFeature.hpp>
+#include <Liger-Engine/Render/BuiltIn/StaticMeshFeature.hpp>
+#include <Liger-Engine/Render/BuiltIn/TonemapFeature.hpp>
+#include <Liger-Engine/Render/Renderer.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+using namespace liger;
+
+namespace {
+
+constexpr const char* kLogChannelBench = "Bench";
+
+constexpr uint32_t kFramesInFlight        = 2U;
+constexpr uint32_t kAllocationCheckWarmup = 8U;
+constexpr uint32_t kAllocationCheckFrames = 64U;
+constexpr uint32_t kLightSeed             = 0x4C494745U;
+
+enum ExitCode : int {
+  kExitSuccess           = 0,
+  kExitInvalidArguments  = 1,
+  kExitInitFailed        = 2,
+  kExitSteadyStateFailed = 3
+};
+
+const rhi::IDevice::Info* SelectDevice(const rhi::IInstance& instance, std::optional<uint32_t> device_id) {
+  for (const auto& info : instance.GetDeviceInfoList()) {
+    if (device_id ? info.id == *device_id : info.engine_supported) {
+      return &info;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * @brief Reference scene: a grid of mesh instances lit by randomly (but reproducibly) placed point lights.
+ */
+ecs::Entity PopulateScene(ecs::Scene& scene, asset::Manager& asset_manager, const bench::BenchOptions& options) {
+  auto& registry = scene.GetRegistry();
+
+  auto mesh = asset_manager.GetAsset<render::StaticMesh>(options.mesh_file);
+
+  const float     half_extent = 0.5f * options.grid_spacing * static_cast<float>(options.grid_size - 1U);
+  const glm::vec3 grid_origin{-half_extent, 0.0f, -half_extent};
+
+  for (uint32_t z = 0U; z < options.grid_size; ++z) {
+    for (uint32_t x = 0U; x < options.grid_size; ++x) {
+      auto entity = scene.CreateEntity();
+
+      auto& transform    = registry.emplace<ecs::WorldTransform>(entity);
+      transform.position = grid_origin + options.grid_spacing * glm::vec3(x, 0.0f, z);
+
+      registry.emplace<render::StaticMeshComponent>(entity, render::StaticMeshComponent{.mesh = mesh});
+    }
+  }
+
+  std::mt19937                          generator(kLightSeed);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+  for (uint32_t light_idx = 0U; light_idx < options.light_count; ++light_idx) {
+    auto entity = scene.CreateEntity();
+
+    auto& transform    = registry.emplace<ecs::WorldTransform>(entity);
+    transform.position = glm::vec3(-half_extent + 2.0f * half_extent * unit(generator), 1.0f + 4.0f * unit(generator),
+                                   -half_extent + 2.0f * half_extent * unit(generator));
+
+    registry.emplace<render::PointLightInfo>(entity, render::PointLightInfo{
+      .color     = glm::vec3(unit(generator), unit(generator), unit(generator)),
+      .intensity = 1.0f + 4.0f * unit(generator),
+      .radius    = 2.0f * options.grid_spacing
+    });
+  }
+
+  auto camera_entity = scene.CreateEntity("Camera");
+  registry.emplace<ecs::WorldTransform>(camera_entity);
+  registry.emplace<ecs::Camera>(camera_entity, ecs::Camera{
+    .fov          = 60.0f,
+    .near         = 0.1f,
+    .far          = 4.0f * half_extent + 100.0f,
+    .aspect       = static_cast<float>(options.width) / static_cast<float>(options.height),
+    .fixed_aspect = true
+  });
+
+  return camera_entity;
+}
+
+/**
+ * @brief Load the scene file, its camera is the first entity with a @ref ecs::Camera.
+ */
+std::optional<ecs::Entity> LoadScene(ecs::Scene& scene, const ecs::SceneFormat& format, asset::Manager& asset_manager,
+                                     const std::filesystem::path& filepath) {
+  Timer timer;
+
+  ecs::SceneFile file;
+  if (!file.Open(filepath) || !format.Load(file, scene, asset_manager)) {
+    return std::nullopt;
+  }
+
+  LIGER_LOG_INFO(kLogChannelBench, "Loaded {0} entities from '{1}' in {2:.2f} ms", file.EntityCount(),
+                 filepath.string(), timer.ElapsedMs());
+
+  auto cameras = scene.GetRegistry().view<ecs::Camera>();
+  if (cameras.begin() == cameras.end()) {
+    LIGER_LOG_ERROR(kLogChannelBench, "Scene '{0}' has no camera", filepath.string());
+    return std::nullopt;
+  }
+
+  return *cameras.begin();
+}
+
+void WriteReport(const bench::BenchReport& report, const std::optional<std::filesystem::path>& output_file) {
+  auto json = report.ToJson();
+
+  if (!output_file) {
+    std::fwrite(json.data(), 1U, json.size(), stdout);
+    return;
+  }
+
+  std::ofstream file(*output_file);
+  if (!file) {
+    LIGER_LOG_ERROR(kLogChannelBench, "Failed to open '{0}' for writing, printing the report instead",
+                    output_file->string());
+    std::fwrite(json.data(), 1U, json.size(), stdout);
+    return;
+  }
+
+  file << json;
+  LIGER_LOG_INFO(kLogChannelBench, "Report is written to '{0}'", output_file->string());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  auto parsed_options = bench::ParseOptions(argc, argv);
+  if (!parsed_options) {
+    return kExitInvalidArguments;
+  }
+
+  const auto& options = *parsed_options;
+
+  Timer load_timer;
+
+  /* Render backend, no window or swapchain is created */
+  tf::Executor executor;
+
+  auto instance = rhi::IInstance::Create(rhi::GraphicsAPI::Vulkan, rhi::IInstance::ValidationLevel::None);
+  if (!instance) {
+    LIGER_LOG_ERROR(kLogChannelBench, "Failed to create the RHI instance");
+    return kExitInitFailed;
+  }
+
+  const auto* device_info = SelectDevice(*instance, options.device_id);
+  if (!device_info) {
+    LIGER_LOG_ERROR(kLogChannelBench, "No suitable device is found");
+    return kExitInitFailed;
+  }
+
+  auto device = instance->CreateDevice(device_info->id, kFramesInFlight);
+  if (!device) {
+    LIGER_LOG_ERROR(kLogChannelBench, "Failed to create device '{0}'", device_info->name);
+    return kExitInitFailed;
+  }
+
+  /* Assets */
+  asset::Manager asset_manager(executor, options.registry_file);
+  if (!asset_manager.Valid()) {
+    LIGER_LOG_ERROR(kLogChannelBench, "Invalid asset registry '{0}'", options.registry_file.string());
+    return kExitInitFailed;
+  }
+
+  asset_manager.AddLoader(std::make_unique<asset::loaders::ShaderLoader>(*device));
+  asset_manager.AddLoader(std::make_unique<asset::loaders::TextureLoader>(*device));
+  asset_manager.AddLoader(std::make_unique<asset::loaders::MaterialLoader>(*device));
+  asset_manager.AddLoader(std::make_unique<asset::loaders::StaticMeshLoader>(*device));
+
+  /* Renderer, drawing into an offscreen target of the requested resolution */
+  auto output_texture = device->CreateTexture(rhi::ITexture::Info{
+    .format = rhi::Format::B8G8R8A8_SRGB,
+    .type   = rhi::TextureType::Texture2D,
+    .usage  = rhi::DeviceResourceState::ColorTarget | rhi::DeviceResourceState::TransferSrc,
+    .extent = rhi::Extent3D{options.width, options.height, 1U},
+    .name   = "Bench Output"
+  });
+
+  render::Renderer renderer(*device);
+
+  auto rg_output = renderer.GetRenderGraphBuilder().ImportTexture({output_texture.get()},
+                                                                  rhi::DeviceResourceState::Undefined,
+                                                                  rhi::DeviceResourceState::ColorTarget);
+
+  renderer.EmplaceFeature(std::make_unique<render::CameraDataCollector>(*device));
+  renderer.EmplaceFeature(std::make_unique<render::ClusteredLightFeature>(asset_manager, executor));
+  renderer.EmplaceFeature(std::make_unique<render::StaticMeshFeature>(*device, asset_manager, executor));
+  renderer.EmplaceFeature(std::make_unique<render::ForwardRenderFeature>(rg_output));
+  renderer.EmplaceFeature(std::make_unique<render::BloomFeature>(asset_manager, render::BloomFeature::Info{}));
+  renderer.EmplaceFeature(std::make_unique<render::TonemapFeature>(asset_manager, 1.0f));
+  renderer.Setup();
+
+  /* Scene */
+  ecs::SceneFormat scene_format;
+  scene_format.RegisterDefaultComponents();
+  scene_format.RegisterComponent<render::PointLightInfo>("PointLightInfo");
+  scene_format.RegisterComponent<render::StaticMeshComponent>("StaticMeshComponent");
+  scene_format.RegisterAsset<render::StaticMesh>("StaticMesh");
+
+  ecs::Scene  scene;
+  ecs::Entity camera_entity{entt::null};
+
+  if (options.scene_file) {
+    auto loaded_camera = LoadScene(scene, scene_format, asset_manager, *options.scene_file);
+    if (!loaded_camera) {
+      LIGER_LOG_ERROR(kLogChannelBench, "Failed to load scene '{0}'", options.scene_file->string());
+      return kExitInitFailed;
+    }
+
+    camera_entity = *loaded_camera;
+  } else {
+    camera_entity = PopulateScene(scene, asset_manager, options);
+
+    if (options.save_scene_file && !scene_format.Save(scene, *options.save_scene_file)) {
+      LIGER_LOG_ERROR(kLogChannelBench, "Failed to save scene '{0}'", options.save_scene_file->string());
+      return kExitInitFailed;
+    }
+  }
+
+  auto systems = renderer.GetSystemTaskflow(scene);
+
+  const float scene_extent = options.grid_spacing * static_cast<float>(options.grid_size);
+  bench::BenchCamera camera(glm::vec3(0.0f), 0.75f * scene_extent + options.grid_spacing);
+
+  EventDispatcher              dispatcher;
+  std::optional<InputReplayer> replayer;
+  if (options.replay_file) {
+    replayer.emplace();
+    if (!replayer->Load(*options.replay_file)) {
+      LIGER_LOG_ERROR(kLogChannelBench, "Failed to load input recording '{0}'", options.replay_file->string());
+      return kExitInitFailed;
+    }
+
+    replayer->SetFixedTimestep(options.timestep);
+    camera.ListenTo(dispatcher);
+  }
+
+  const float load_time_ms = load_timer.ElapsedMs();
+
+  /* Frame loop */
+  FrameTimer         frame_timer(options.measured_frames);
+  bench::BenchReport report;
+  bool               measuring = false;
+
+  frame_timer.SetCaptureHook([&report, &measuring](const FrameHitchEvent&) {
+    if (measuring) {
+      report.AddHitch();
+    }
+  });
+
+  /*
+   * Frame task graph. With pipelining the render work renders the state extracted in the previous frame, while the
+   * next frame is being simulated, and the extraction runs once both are done. Otherwise the frame is simulated,
+   * extracted and rendered in sequence.
+   */
+  float          frame_dt = options.timestep;
+  FrameTaskGraph frame_graph("Bench Frame");
+
+  auto begin_frame = frame_graph.Emplace("Device: BeginFrame", [&]() {
+    /* Waiting for the frame-in-flight fence is the headless analogue of waiting for present */
+    ScopedFramePhase phase(frame_timer, FramePhase::PresentWait);
+    device->BeginOffscreenFrame();
+  }, TaskPriority::High);
+
+  auto simulation = frame_graph.Emplace("Simulation", [&]() {
+    ScopedFramePhase phase(frame_timer, FramePhase::Simulation);
+    camera.Update(scene.GetRegistry().get<ecs::WorldTransform>(camera_entity), frame_dt);
+    executor.corun(systems);
+  });
+
+  auto extract = frame_graph.Emplace("Render: Extract", [&]() { renderer.Extract(); }, TaskPriority::High);
+
+  auto render_begin = frame_graph.Emplace("Render: Begin", [&]() { frame_timer.BeginPhase(FramePhase::RenderPrep); });
+  auto render_end   = renderer.AddFrameTasks(frame_graph, render_begin);
+
+  auto end_frame = frame_graph.Emplace("Device: EndFrame", [&]() {
+    frame_timer.EndPhase(FramePhase::RenderPrep);
+
+    ScopedFramePhase phase(frame_timer, FramePhase::Submit);
+    device->EndOffscreenFrame();
+  }, TaskPriority::High);
+
+  frame_graph.Precede(render_end, end_frame);
+
+  if (options.pipelined) {
+    frame_graph.Precede(begin_frame, render_begin);
+    frame_graph.Precede(simulation, extract);
+
+    /* Extract may create buffers and write descriptors, which must not overlap with the device's frame submission */
+    frame_graph.Precede(end_frame, extract);
+
+    /* Fill the pipeline, so the first frame does not render an empty scene */
+    camera.Update(scene.GetRegistry().get<ecs::WorldTransform>(camera_entity), frame_dt);
+    executor.run(systems).wait();
+    renderer.Extract();
+  } else {
+    frame_graph.Precede(begin_frame, simulation);
+    frame_graph.Precede(simulation, extract);
+    frame_graph.Precede(extract, render_begin);
+  }
+
+  auto run_frame = [&]() {
+    frame_timer.BeginFrame();
+    if (measuring) {
+      report.AddPhaseTimes(frame_timer);
+    }
+
+    frame_dt = replayer ? replayer->NextFrame(dispatcher) : options.timestep;
+    dispatcher.DispatchQueued();
+
+    frame_graph.Run(executor);
+  };
+
+  for (uint32_t frame = 0U; frame < options.warmup_frames; ++frame) {
+    run_frame();
+  }
+
+  for (uint32_t frame = 0U; frame < options.measured_frames; ++frame) {
+    run_frame();
+
+    report.AddRenderStats(renderer.GetFeatureStats(), renderer.GetExecuteTimeMs(),
+                          renderer.GetRenderGraph().LastGpuTimeMs());
+
+    /* Phase times of the first measured frame are only available at the beginning of the next one */
+    measuring = true;
+  }
+
+  /* Close the last measured frame */
+  frame_timer.BeginFrame();
+  report.AddPhaseTimes(frame_timer);
+  report.SetCriticalPath(frame_graph);
+  measuring = false;
+
+  /* Taken before the allocation check, which runs frames of its own */
+  report.SetCpuFrameStatistics(frame_timer.CalculateStatistics());
+  report.SetSystemStats(renderer.GetSystemGraph().GetStats());
+
+  int exit_code = kExitSuccess;
+
+  if (options.check_allocations) {
+    if (!AllocationTracker::Available()) {
+      LIGER_LOG_ERROR(kLogChannelBench, "Allocation tracking is not available, build with LIGER_TRACK_ALLOCATIONS=ON");
+      exit_code = kExitSteadyStateFailed;
+    } else if (!AllocationTracker::CheckSteadyState(kAllocationCheckWarmup, kAllocationCheckFrames, run_frame)) {
+      exit_code = kExitSteadyStateFailed;
+    }
+  }
+
+  device->WaitIdle();
+
+  report.SetDeviceName(device_info->name);
+  report.SetResolution(options.width, options.height);
+  report.SetWarmupFrames(options.warmup_frames);
+  report.SetLoadTimeMs(load_time_ms);
+  report.SetMemoryUsage(bench::PeakResidentSetBytes(), device->GetMemoryUsage());
+
+  WriteReport(report, options.output_file);
+
+  return exit_code;
+}
@@ -78,6 +78,38 @@ else()
   message("-- Thread sanitizer disabled")
 endif()
 
+# Allocation tracking (replaces global operator new/delete)
+option(LIGER_TRACK_ALLOCATIONS "Enable heap allocation tracking via AllocationTracker" OFF)
+
+if(LIGER_TRACK_ALLOCATIONS)
+  message("-- Allocation tracking enabled")
+  add_liger_compile_flags("-DLIGER_TRACK_ALLOCATIONS")
+else()
+  message("-- Allocation tracking disabled")
+endif()
+
+# SIMD (x86-64 only, other architectures use scalar fallbacks)
+option(LIGER_ENABLE_SSE4 "Enable SSE4.1 code paths (x86-64 only)" ON)
+option(LIGER_ENABLE_AVX2 "Enable AVX2 code paths (x86-64 only)" OFF)
+
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|amd64")
+  if(LIGER_ENABLE_AVX2)
+    message("-- AVX2 enabled")
+
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+      add_liger_compile_flags("/arch:AVX2")
+    else()
+      add_liger_compile_flags("-mavx2 -mfma")
+    endif()
+  elseif(LIGER_ENABLE_SSE4)
+    message("-- SSE4.1 enabled")
+
+    if(NOT CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+      add_liger_compile_flags("-msse4.1")
+    endif()
+  endif()
+endif()
+
 # Warnings
 option(LIGER_ENABLE_WARNINGS "Enable warnings when compiling" OFF)
 
@@ -76,6 +76,11 @@ class Handle {
 
   State GetState() const;
 
+  /**
+   * @brief Id of the asset, @ref kInvalidId for a null handle.
+   */
+  Id GetId() const;
+
   void UpdateState(State new_state);
 
  private:
@@ -119,6 +124,11 @@ State Handle<Asset>::GetState() const {
   return reference_->state.load();
 }
 
+template <typename Asset>
+Id Handle<Asset>::GetId() const {
+  return reference_.GetKey();
+}
+
 template <typename Asset>
 void Handle<Asset>::UpdateState(State new_state) {
   reference_->state.store(new_state);
@@ -28,7 +28,9 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <unordered_set>
 #include <vector>
 
 namespace liger {
@@ -51,27 +53,45 @@ class DAG<void> {
 
   NodeHandle DeclareNode();
 
-  void AddEdge(NodeHandle from, NodeHandle to);
+  /**
+   * @brief Add the edge unless it already exists.
+   * @return Whether the edge has been added.
+   */
+  bool AddEdge(NodeHandle from, NodeHandle to);
   bool EdgeExists(NodeHandle from, NodeHandle to) const;
 
   const AdjacencyList& GetAdjacencyList(NodeHandle handle) const;
 
-  bool TopologicalSort(SortedList& out_sorted);
-  bool TopologicalSort(SortedList& out_sorted, DepthList& out_depth, Depth& out_max_depth);
+  /**
+   * @brief Iterative (Kahn's) topological sort.
+   *
+   * Nodes are emitted level by level, i.e. sorted by their depth (the longest path from any source
+   * node), and by their handle within the same level.
+   *
+   * @return Whether the sort succeeded, i.e. the graph has no cycles.
+   */
+  bool TopologicalSort(SortedList& out_sorted) const;
+  bool TopologicalSort(SortedList& out_sorted, DepthList& out_depth, Depth& out_max_depth) const;
+
+  /**
+   * @brief Remove all edges implied by other paths, preserving reachability between nodes.
+   *
+   * Takes O(V * E / 64) time and O(V^2 / 8) memory.
+   *
+   * @return Whether the reduction succeeded, i.e. the graph has no cycles.
+   */
+  bool TransitiveReduction();
 
   size_t Size() const;
+  size_t EdgeCount() const;
 
   DAG<void> Reverse() const;
 
  private:
-  using DFSVisitedList = std::vector<bool>;
-  using DFSOnStackList = std::vector<bool>;
+  static uint64_t EdgeKey(NodeHandle from, NodeHandle to);
 
-  bool TopologicalSortDFS(SortedList& out_sorted, NodeHandle from_handle, DFSVisitedList& visited,
-                          DFSOnStackList& on_stack);
-  void CalculateDepths(const SortedList& sorted, DepthList& out_depth, Depth& out_max_depth);
-
-  std::vector<AdjacencyList> adj_lists_;
+  std::vector<AdjacencyList>   adj_lists_;
+  std::unordered_set<uint64_t> edges_;
 };
 
 template <typename Node>
@@ -90,7 +110,7 @@ class DAG : public DAG<void> {
 
   NodeHandle EmplaceNode(Node&& node);
 
-  void AddEdge(const Node& from, const Node& to);
+  bool AddEdge(const Node& from, const Node& to);
 
   bool EdgeExists(const Node& from, const Node& to) const;
 
@@ -125,8 +145,8 @@ typename DAG<Node>::NodeHandle DAG<Node>::EmplaceNode(Node&& node) {
 }
 
 template <typename Node>
-void DAG<Node>::AddEdge(const Node& from, const Node& to) {
-  DAG<void>::AddEdge(GetNodeHandle(from), GetNodeHandle(to));
+bool DAG<Node>::AddEdge(const Node& from, const Node& to) {
+  return DAG<void>::AddEdge(GetNodeHandle(from), GetNodeHandle(to));
 }
 
 template <typename Node>
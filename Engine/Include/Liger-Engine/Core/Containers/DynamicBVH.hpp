@@ -0,0 +1,364 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file DynamicBVH.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
+#include <Liger-Engine/Core/Math/Bounds.hpp>
+
+#include <taskflow/algorithm/for_each.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace liger {
+
+namespace detail {
+
+/**
+ * @brief Traversal stack of the BVH queries, only allocates for unusually deep trees.
+ */
+class BVHTraversalStack {
+ public:
+  bool Empty() const { return size_ == 0U; }
+
+  void Push(uint32_t node) {
+    if (size_ < kInlineCapacity) {
+      inline_[size_] = node;
+    } else {
+      overflow_.push_back(node);
+    }
+
+    ++size_;
+  }
+
+  uint32_t Pop() {
+    --size_;
+    if (size_ < kInlineCapacity) {
+      return inline_[size_];
+    }
+
+    const uint32_t node = overflow_.back();
+    overflow_.pop_back();
+    return node;
+  }
+
+ private:
+  static constexpr uint32_t kInlineCapacity = 64U;
+
+  std::array<uint32_t, kInlineCapacity> inline_;
+  std::vector<uint32_t>                 overflow_;
+  uint32_t                              size_{0U};
+};
+
+template <typename Callback>
+bool InvokeBVHCallback(Callback& callback, uint32_t user_data) {
+  if constexpr (std::is_void_v<std::invoke_result_t<Callback&, uint32_t>>) {
+    callback(user_data);
+    return true;
+  } else {
+    return static_cast<bool>(callback(user_data));
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Dynamic bounding volume hierarchy over boxes with 32-bit user data, e.g. entity bounds.
+ *
+ * Leaves store their boxes enlarged by a margin, so objects moving within the enlarged box do not touch the
+ * tree at all. Leaves which left their enlarged boxes are reinserted on @ref Commit, insertion picks the sibling
+ * by the surface area heuristic and keeps the tree balanced with AVL rotations. If too many leaves have moved,
+ * or the tree's SAH cost has grown too much since the last build, the whole tree is rebuilt top-down with
+ * binned SAH instead.
+ *
+ * Query callbacks take the user data and may return false to stop the query. Queries are read-only and can run
+ * concurrently with each other, but not with modifications. Moves are only visible to queries after @ref Commit.
+ */
+class DynamicBVH {
+ public:
+  static constexpr uint32_t kInvalidProxy = FreeList::kInvalidIndex;
+
+  struct Policy {
+    /** @brief Leaves' boxes are enlarged by this fraction of their size on each side. */
+    float relative_margin{0.1f};
+
+    /** @brief Leaves' boxes are additionally enlarged by this distance on each side. */
+    float absolute_margin{0.05f};
+
+    /** @brief Rebuild instead of reinserting, if more than this fraction of the leaves has moved. */
+    float rebuild_moved_fraction{0.25f};
+
+    /** @brief Rebuild if the SAH cost per leaf has grown by this factor since the last build. */
+    float rebuild_cost_ratio{1.5f};
+  };
+
+  DynamicBVH();
+  explicit DynamicBVH(Policy policy);
+
+  /**
+   * @return Proxy id, stable until the proxy is destroyed.
+   */
+  uint32_t CreateProxy(const AABB& box, uint32_t user_data);
+
+  void DestroyProxy(uint32_t proxy);
+
+  /**
+   * @brief Update the proxy's box, the proxy is reinserted on @ref Commit if the box left the enlarged one.
+   * @return Whether the proxy is going to be reinserted.
+   */
+  bool MoveProxy(uint32_t proxy, const AABB& box);
+
+  /**
+   * @brief Reinsert the moved proxies or rebuild the tree according to the policy.
+   */
+  void Commit();
+
+  /**
+   * @brief Rebuild the tree top-down with binned SAH, proxy ids are preserved.
+   */
+  void Rebuild();
+
+  void Clear();
+
+  uint32_t GetUserData(uint32_t proxy) const;
+
+  /**
+   * @brief Exact box of the proxy, as passed to @ref CreateProxy or @ref MoveProxy.
+   */
+  const AABB& GetBox(uint32_t proxy) const;
+
+  uint32_t ProxyCount() const;
+  uint32_t Height() const;
+
+  /**
+   * @brief Sum of the internal nodes' surface areas, proportional to the expected query cost.
+   */
+  float Cost() const;
+
+  template <typename Callback>
+  void Query(const AABB& box, Callback&& callback) const;
+
+  template <typename Callback>
+  void Query(const Sphere& sphere, Callback&& callback) const;
+
+  template <typename Callback>
+  void Query(const Frustum& frustum, Callback&& callback) const;
+
+  /**
+   * @brief Find the proxies hit by the ray.
+   *
+   * The callback takes the user data and the hit distance, and returns the max distance of further hits, e.g.
+   * the hit distance to only look for closer hits, max_distance to find all hits, or 0 to stop.
+   */
+  template <typename Callback>
+  void Raycast(const Ray& ray, float max_distance, Callback&& callback) const;
+
+  /**
+   * @brief Run the queries on the executor's workers, callback(query_idx, user_data) must be thread-safe.
+   */
+  template <typename Shape, typename Callback>
+  void QueryBatch(tf::Executor& executor, std::span<const Shape> shapes, Callback&& callback) const;
+
+ private:
+  static constexpr uint32_t kNullNode = FreeList::kInvalidIndex;
+
+  struct Node {
+    bool IsLeaf() const { return children[0] == kNullNode; }
+
+    /** Enlarged box for leaves */
+    AABB                    box;
+    AABB                    tight_box;
+    uint32_t                parent    {kNullNode};
+    std::array<uint32_t, 2> children  {kNullNode, kNullNode};
+    int32_t                 height    {0};
+    uint32_t                user_data {0U};
+    bool                    moved     {false};
+  };
+
+  uint32_t AllocateNode();
+  void FreeNode(uint32_t node);
+
+  AABB Enlarge(const AABB& box) const;
+
+  void SetInternalBox(uint32_t node, const AABB& box);
+  void Refit(uint32_t node);
+
+  void InsertLeaf(uint32_t leaf);
+  void RemoveLeaf(uint32_t leaf);
+  uint32_t Balance(uint32_t node);
+
+  uint32_t BuildRange(std::span<uint32_t> leaves);
+
+  float CostPerLeaf() const;
+
+  template <typename Classify, typename Callback>
+  void Traverse(Classify&& classify, Callback&& callback) const;
+
+  template <typename Callback>
+  bool VisitLeaves(uint32_t node, Callback& callback) const;
+
+  Policy                policy_;
+  std::vector<Node>     nodes_;
+  FreeList              node_ids_;
+  uint32_t              root_{kNullNode};
+  uint32_t              proxy_count_{0U};
+  std::vector<uint32_t> moved_;
+
+  float                 cost_{0.0f};
+  float                 built_cost_per_leaf_{0.0f};
+};
+
+template <typename Callback>
+void DynamicBVH::Query(const AABB& box, Callback&& callback) const {
+  Traverse([&box](const AABB& node_box) { return box.Classify(node_box); }, callback);
+}
+
+template <typename Callback>
+void DynamicBVH::Query(const Sphere& sphere, Callback&& callback) const {
+  Traverse([&sphere](const AABB& node_box) { return sphere.Classify(node_box); }, callback);
+}
+
+template <typename Callback>
+void DynamicBVH::Query(const Frustum& frustum, Callback&& callback) const {
+  Traverse([&frustum](const AABB& node_box) { return frustum.Classify(node_box); }, callback);
+}
+
+template <typename Callback>
+void DynamicBVH::Raycast(const Ray& ray, float max_distance, Callback&& callback) const {
+  if (root_ == kNullNode) {
+    return;
+  }
+
+  const glm::vec3 inverse_direction = ray.InverseDirection();
+
+  detail::BVHTraversalStack stack;
+  stack.Push(root_);
+
+  while (!stack.Empty()) {
+    const auto& node = nodes_[stack.Pop()];
+
+    float distance = 0.0f;
+    if (!ray.Intersect(node.IsLeaf() ? node.tight_box : node.box, inverse_direction, max_distance, distance)) {
+      continue;
+    }
+
+    if (node.IsLeaf()) {
+      const float new_max_distance = callback(node.user_data, distance);
+      if (new_max_distance <= 0.0f) {
+        return;
+      }
+
+      max_distance = std::min(max_distance, new_max_distance);
+      continue;
+    }
+
+    stack.Push(node.children[0]);
+    stack.Push(node.children[1]);
+  }
+}
+
+template <typename Shape, typename Callback>
+void DynamicBVH::QueryBatch(tf::Executor& executor, std::span<const Shape> shapes, Callback&& callback) const {
+  tf::Taskflow taskflow;
+  taskflow.for_each_index(size_t{0U}, shapes.size(), size_t{1U}, [this, shapes, &callback](size_t query_idx) {
+    Query(shapes[query_idx], [&callback, query_idx](uint32_t user_data) { return callback(query_idx, user_data); });
+  });
+
+  /* Called from a worker, e.g. by a system, help executing the queries instead of blocking the worker */
+  if (executor.this_worker_id() >= 0) {
+    executor.corun(taskflow);
+  } else {
+    executor.run(taskflow).wait();
+  }
+}
+
+template <typename Classify, typename Callback>
+void DynamicBVH::Traverse(Classify&& classify, Callback&& callback) const {
+  if (root_ == kNullNode) {
+    return;
+  }
+
+  detail::BVHTraversalStack stack;
+  stack.Push(root_);
+
+  while (!stack.Empty()) {
+    const uint32_t node_idx = stack.Pop();
+    const auto&    node     = nodes_[node_idx];
+
+    const Containment containment = classify(node.IsLeaf() ? node.tight_box : node.box);
+    if (containment == Containment::Outside) {
+      continue;
+    }
+
+    if (node.IsLeaf()) {
+      if (!detail::InvokeBVHCallback(callback, node.user_data)) {
+        return;
+      }
+      continue;
+    }
+
+    /* The whole subtree is inside, no need to test its nodes */
+    if (containment == Containment::Inside) {
+      if (!VisitLeaves(node_idx, callback)) {
+        return;
+      }
+      continue;
+    }
+
+    stack.Push(node.children[0]);
+    stack.Push(node.children[1]);
+  }
+}
+
+template <typename Callback>
+bool DynamicBVH::VisitLeaves(uint32_t node_idx, Callback& callback) const {
+  detail::BVHTraversalStack stack;
+  stack.Push(node_idx);
+
+  while (!stack.Empty()) {
+    const auto& node = nodes_[stack.Pop()];
+
+    if (node.IsLeaf()) {
+      if (!detail::InvokeBVHCallback(callback, node.user_data)) {
+        return false;
+      }
+      continue;
+    }
+
+    stack.Push(node.children[0]);
+    stack.Push(node.children[1]);
+  }
+
+  return true;
+}
+
+}  // namespace liger
@@ -0,0 +1,126 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FreeList.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace liger {
+
+enum class FreeListPolicy : uint8_t {
+  /** The most recently freed index is reused first */
+  Lifo,
+
+  /** The lowest free index is reused first, which keeps arrays indexed by the allocated indices compact */
+  LowestIndexFirst
+};
+
+/**
+ * @brief Allocator of stable indices in [0, capacity), e.g. slots of a GPU array.
+ *
+ * Allocation and freeing are O(1) with @ref FreeListPolicy::Lifo. With @ref FreeListPolicy::LowestIndexFirst the
+ * lowest free index is found by scanning a bitmask 64 indices at a time, starting from the lowest word that may
+ * have a free bit. Not thread-safe.
+ */
+class FreeList {
+ public:
+  static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  explicit FreeList(uint32_t capacity = 0U, FreeListPolicy policy = FreeListPolicy::Lifo);
+
+  /**
+   * @return Allocated index or @ref kInvalidIndex if all indices are allocated.
+   */
+  [[nodiscard]] uint32_t Allocate();
+
+  void Free(uint32_t index);
+
+  /**
+   * @brief Increase the capacity, new indices are free.
+   */
+  void Grow(uint32_t new_capacity);
+
+  /**
+   * @brief Free all indices.
+   */
+  void Clear();
+
+  bool IsAllocated(uint32_t index) const;
+
+  uint32_t Size() const;
+  uint32_t Capacity() const;
+  bool Full() const;
+
+  /**
+   * @brief One past the highest allocated index, i.e. the used part of an array indexed by the allocated indices.
+   */
+  uint32_t End() const;
+
+  /**
+   * @brief Call the function for each allocated index in ascending order.
+   */
+  template <typename Func>
+  void ForEachAllocated(Func&& func) const;
+
+ private:
+  static constexpr uint32_t kWordBits = 64U;
+
+  FreeListPolicy        policy_;
+  uint32_t              capacity_{0U};
+  uint32_t              size_{0U};
+
+  /** Bit is set if the index is free */
+  std::vector<uint64_t> free_bits_;
+
+  /** Free indices for @ref FreeListPolicy::Lifo */
+  std::vector<uint32_t> free_stack_;
+
+  /** Lowest word which may have a free bit for @ref FreeListPolicy::LowestIndexFirst */
+  uint32_t              first_free_word_{0U};
+};
+
+template <typename Func>
+void FreeList::ForEachAllocated(Func&& func) const {
+  for (uint32_t word_idx = 0U; word_idx < free_bits_.size(); ++word_idx) {
+    uint64_t allocated = ~free_bits_[word_idx];
+
+    while (allocated != 0U) {
+      const auto index = word_idx * kWordBits + static_cast<uint32_t>(std::countr_zero(allocated));
+      if (index >= capacity_) {
+        return;
+      }
+
+      func(index);
+      allocated &= allocated - 1U;
+    }
+  }
+}
+
+}  // namespace liger
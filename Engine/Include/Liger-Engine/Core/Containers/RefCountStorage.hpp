@@ -72,6 +72,11 @@ class RefCountStorage {
 
     explicit operator bool() const;
 
+    /**
+     * @brief Key the value is stored by, default constructed for a null reference.
+     */
+    Key GetKey() const;
+
    private:
     explicit Reference(ControlBlock* control_block);
 
@@ -261,4 +266,9 @@ RefCountStorage<Key, Value>::Reference::operator bool() const {
   return block_ != nullptr;
 }
 
+template <typename Key, typename Value>
+Key RefCountStorage<Key, Value>::Reference::GetKey() const {
+  return block_ ? block_->key : Key{};
+}
+
 }  // namespace liger
\ No newline at end of file
@@ -0,0 +1,228 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file SlotMap.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
+#include <Liger-Engine/Core/Log/Log.hpp>
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+#include <algorithm>
+#include <span>
+
+namespace liger {
+
+/**
+ * @brief Handle to a @ref SlotMap value, which becomes stale once the value is erased.
+ */
+struct SlotHandle {
+  static constexpr uint32_t kInvalidIndex = FreeList::kInvalidIndex;
+
+  uint32_t index{kInvalidIndex};
+  uint32_t generation{0U};
+
+  explicit operator bool() const { return index != kInvalidIndex; }
+  bool operator==(const SlotHandle& other) const = default;
+};
+
+/**
+ * @brief Container with O(1) insertion, erasure and lookup by generational handles.
+ *
+ * Values are stored densely, so iteration does not skip holes, but erasure moves the last value into the hole.
+ * Handle indices are stable and can be used to index GPU arrays, see @ref FreeListPolicy. Not thread-safe.
+ */
+template <typename T>
+class SlotMap {
+ public:
+  explicit SlotMap(uint32_t capacity = 0U, FreeListPolicy policy = FreeListPolicy::Lifo);
+
+  template <typename... Args>
+  SlotHandle Emplace(Args&&... args);
+
+  /**
+   * @return Whether the value was present.
+   */
+  bool Erase(SlotHandle handle);
+
+  void Clear();
+
+  bool Contains(SlotHandle handle) const;
+
+  /**
+   * @return Value or nullptr if the handle is stale.
+   */
+  T*       Get(SlotHandle handle);
+  const T* Get(SlotHandle handle) const;
+
+  uint32_t Size() const;
+  bool Empty() const;
+
+  /**
+   * @brief One past the highest index of a live handle.
+   */
+  uint32_t IndexEnd() const;
+
+  /**
+   * @brief Handle of the dense value, i.e. of Values()[dense_idx].
+   */
+  SlotHandle HandleAt(uint32_t dense_idx) const;
+
+  std::span<T>       Values();
+  std::span<const T> Values() const;
+
+  auto begin()       { return values_.begin(); }
+  auto end()         { return values_.end(); }
+  auto begin() const { return values_.begin(); }
+  auto end() const   { return values_.end(); }
+
+ private:
+  struct Slot {
+    uint32_t dense_idx{SlotHandle::kInvalidIndex};
+    uint32_t generation{0U};
+  };
+
+  FreeList              indices_;
+  std::vector<Slot>     slots_;
+  std::vector<T>        values_;
+  std::vector<uint32_t> dense_to_index_;
+};
+
+template <typename T>
+SlotMap<T>::SlotMap(uint32_t capacity, FreeListPolicy policy) : indices_(capacity, policy) {
+  slots_.resize(capacity);
+  values_.reserve(capacity);
+  dense_to_index_.reserve(capacity);
+}
+
+template <typename T>
+template <typename... Args>
+SlotHandle SlotMap<T>::Emplace(Args&&... args) {
+  if (indices_.Full()) {
+    const auto new_capacity = std::max(2U * indices_.Capacity(), 8U);
+
+    indices_.Grow(new_capacity);
+    slots_.resize(new_capacity);
+  }
+
+  const auto index = indices_.Allocate();
+  auto&      slot  = slots_[index];
+
+  slot.dense_idx = static_cast<uint32_t>(values_.size());
+  values_.emplace_back(std::forward<Args>(args)...);
+  dense_to_index_.push_back(index);
+
+  return SlotHandle{.index = index, .generation = slot.generation};
+}
+
+template <typename T>
+bool SlotMap<T>::Erase(SlotHandle handle) {
+  if (!Contains(handle)) {
+    return false;
+  }
+
+  auto&          slot      = slots_[handle.index];
+  const uint32_t dense_idx = slot.dense_idx;
+  const uint32_t last_idx  = static_cast<uint32_t>(values_.size()) - 1U;
+
+  if (dense_idx != last_idx) {
+    values_[dense_idx]                           = std::move(values_[last_idx]);
+    dense_to_index_[dense_idx]                   = dense_to_index_[last_idx];
+    slots_[dense_to_index_[dense_idx]].dense_idx = dense_idx;
+  }
+
+  values_.pop_back();
+  dense_to_index_.pop_back();
+
+  slot.dense_idx = SlotHandle::kInvalidIndex;
+  ++slot.generation;
+  indices_.Free(handle.index);
+
+  return true;
+}
+
+template <typename T>
+void SlotMap<T>::Clear() {
+  for (auto index : dense_to_index_) {
+    slots_[index].dense_idx = SlotHandle::kInvalidIndex;
+    ++slots_[index].generation;
+  }
+
+  values_.clear();
+  dense_to_index_.clear();
+  indices_.Clear();
+}
+
+template <typename T>
+bool SlotMap<T>::Contains(SlotHandle handle) const {
+  return handle.index < slots_.size() && slots_[handle.index].generation == handle.generation &&
+         slots_[handle.index].dense_idx != SlotHandle::kInvalidIndex;
+}
+
+template <typename T>
+T* SlotMap<T>::Get(SlotHandle handle) {
+  return Contains(handle) ? &values_[slots_[handle.index].dense_idx] : nullptr;
+}
+
+template <typename T>
+const T* SlotMap<T>::Get(SlotHandle handle) const {
+  return Contains(handle) ? &values_[slots_[handle.index].dense_idx] : nullptr;
+}
+
+template <typename T>
+uint32_t SlotMap<T>::Size() const {
+  return static_cast<uint32_t>(values_.size());
+}
+
+template <typename T>
+bool SlotMap<T>::Empty() const {
+  return values_.empty();
+}
+
+template <typename T>
+uint32_t SlotMap<T>::IndexEnd() const {
+  return indices_.End();
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::HandleAt(uint32_t dense_idx) const {
+  LIGER_ASSERT(dense_idx < values_.size(), kLogChannelCore, "Dense index {0} is out of range", dense_idx);
+
+  const auto index = dense_to_index_[dense_idx];
+  return SlotHandle{.index = index, .generation = slots_[index].generation};
+}
+
+template <typename T>
+std::span<T> SlotMap<T>::Values() {
+  return values_;
+}
+
+template <typename T>
+std::span<const T> SlotMap<T>::Values() const {
+  return values_;
+}
+
+}  // namespace liger
@@ -27,12 +27,10 @@
 
 #pragma once
 
-#include <Liger-Engine/Core/Log/Log.hpp>
-#include <Liger-Engine/Core/LogChannel.hpp>
+#include <Liger-Engine/Core/TypeSlot.hpp>
 
-#include <typeindex>
-#include <typeinfo>
-#include <unordered_map>
+#include <memory>
+#include <vector>
 
 namespace liger::detail {
 
@@ -52,24 +50,32 @@ struct TypeMapHolder : IBaseTypeMapHolder {
 
 namespace liger {
 
+/**
+ * @brief Map from a type to an instance of @p Value<Type>.
+ *
+ * Values are stored in a flat array indexed by the per-type slot id, so lookup is an array access
+ * instead of hashing the type info. The addresses of values are stable.
+ */
 template <template <typename> typename Value>
 class TypeMap {
  public:
   template <typename Type>
   Value<Type>& Get() {
-    auto it = holders_.find(typeid(Type));
-    if (it == holders_.end()) {
-      auto result = holders_.emplace(typeid(Type), std::make_unique<detail::TypeMapHolder<Value<Type>>>());
-      LIGER_ASSERT(result.second, kLogChannelCore, "Failed to insert TypeMapHolder, Type = {0}", typeid(Type).name());
+    const auto slot = TypeSlot<TypeMap, Type>::Value();
+    if (slot >= holders_.size()) {
+      holders_.resize(slot + 1);
+    }
 
-      it = result.first;
+    auto& holder = holders_[slot];
+    if (!holder) {
+      holder = std::make_unique<detail::TypeMapHolder<Value<Type>>>();
     }
 
-    return static_cast<detail::TypeMapHolder<Value<Type>>*>(it->second.get())->value;
+    return static_cast<detail::TypeMapHolder<Value<Type>>*>(holder.get())->value;
   }
 
  private:
-  std::unordered_map<std::type_index, std::unique_ptr<detail::IBaseTypeMapHolder>> holders_;
+  std::vector<std::unique_ptr<detail::IBaseTypeMapHolder>> holders_;
 };
 
-}  // namespace liger
\ No newline at end of file
+}  // namespace liger
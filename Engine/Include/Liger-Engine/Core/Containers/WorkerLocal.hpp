@@ -0,0 +1,117 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file WorkerLocal.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace liger {
+
+/**
+ * @brief A value per executor worker, so that tasks can collect data without locks or atomics.
+ *
+ * Slots are indexed by the worker id (e.g. `tf::Executor::this_worker_id()`), with one extra slot shared by all
+ * threads outside the executor, which therefore must not use it concurrently. Slots are cache-line aligned to avoid
+ * false sharing between workers.
+ */
+template <typename T>
+class WorkerLocal {
+ public:
+  explicit WorkerLocal(uint32_t worker_count = 0U) { Resize(worker_count); }
+
+  /**
+   * @note Not thread-safe, the existing values are kept.
+   */
+  void Resize(uint32_t worker_count) { slots_.resize(worker_count + 1U); }
+
+  /**
+   * @param worker_id Id of the calling worker, negative for threads outside the executor.
+   */
+  T& Local(int32_t worker_id) {
+    const auto slot = (worker_id < 0) ? slots_.size() - 1U : static_cast<size_t>(worker_id);
+    return slots_[slot].value;
+  }
+
+  uint32_t SlotCount() const { return static_cast<uint32_t>(slots_.size()); }
+
+  T&       operator[](uint32_t slot)       { return slots_[slot].value; }
+  const T& operator[](uint32_t slot) const { return slots_[slot].value; }
+
+  template <typename Func>
+  void ForEach(Func&& func) {
+    for (auto& slot : slots_) {
+      func(slot.value);
+    }
+  }
+
+  template <typename Func>
+  void ForEach(Func&& func) const {
+    for (const auto& slot : slots_) {
+      func(slot.value);
+    }
+  }
+
+ private:
+  static constexpr size_t kCacheLineSize = 64U;
+
+  struct alignas(kCacheLineSize) Slot {
+    T value{};
+  };
+
+  std::vector<Slot> slots_;
+};
+
+/**
+ * @return Total number of values appended by all workers.
+ */
+template <typename T>
+size_t TotalSize(const WorkerLocal<std::vector<T>>& buffers) {
+  size_t size = 0U;
+  buffers.ForEach([&size](const std::vector<T>& values) { size += values.size(); });
+  return size;
+}
+
+/**
+ * @brief Copy the values of all workers into one contiguous array, e.g. a mapped GPU buffer.
+ *
+ * Each worker's values are written at the prefix sum of the preceding workers' sizes, in slot order.
+ *
+ * @return Number of values written, @ref TotalSize.
+ */
+template <typename T>
+size_t CopyContiguous(const WorkerLocal<std::vector<T>>& buffers, T* dst) {
+  size_t offset = 0U;
+  buffers.ForEach([dst, &offset](const std::vector<T>& values) {
+    std::copy(values.begin(), values.end(), dst + offset);
+    offset += values.size();
+  });
+  return offset;
+}
+
+}  // namespace liger
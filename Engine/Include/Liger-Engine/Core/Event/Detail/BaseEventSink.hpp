@@ -27,11 +27,15 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace liger::detail {
 
 class IBaseEventSink {
  public:
   virtual ~IBaseEventSink() = default;
+
+  virtual size_t DispatchQueued() = 0;
 };
 
 }  // namespace liger::detail
\ No newline at end of file
@@ -27,16 +27,20 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 namespace liger::detail {
 
 using EventTypeId = uint32_t;
 
+/**
+ * @brief Generates dense zero-based ids, so that they can be used as indices into a flat array.
+ */
 struct EventTypeIdGenerator {
   static EventTypeId NextId() {
-    static EventTypeId id{0};
-    return ++id;
+    static std::atomic<EventTypeId> id{0};
+    return id.fetch_add(1, std::memory_order_relaxed);
   }
 };
 
@@ -30,15 +30,36 @@
 #include <Liger-Engine/Core/Event/Detail/EventType.hpp>
 #include <Liger-Engine/Core/Event/EventSink.hpp>
 
-#include <unordered_map>
+#include <array>
+#include <memory>
 
 namespace liger {
 
 /**
  * @brief Container of per event type sinks.
+ *
+ * Sinks are stored in a flat array indexed by the compile-time assigned event type id, so both
+ * sink lookup and sink creation are lock-free and can be done from any thread.
+ *
+ * Events can either be dispatched immediately via @ref Dispatch, or deferred via @ref Enqueue
+ * (from any thread) and dispatched in a batch at a well-defined point via @ref DispatchQueued.
  */
 class EventDispatcher {
  public:
+  /**
+   * @brief Max number of different event types.
+   */
+  static constexpr detail::EventTypeId kMaxEventTypes = 256;
+
+  EventDispatcher() = default;
+  ~EventDispatcher();
+
+  EventDispatcher(const EventDispatcher& other)            = delete;
+  EventDispatcher& operator=(const EventDispatcher& other) = delete;
+
+  EventDispatcher(EventDispatcher&& other)            = delete;
+  EventDispatcher& operator=(EventDispatcher&& other) = delete;
+
   /**
    * @brief Get the sink for the particular @ref EventT.
    * 
@@ -60,20 +81,59 @@ class EventDispatcher {
   template <typename EventT>
   bool Dispatch(const EventT& event, bool dispatch_to_all = false);
 
+  /**
+   * @brief Defer the event until the next @ref DispatchQueued call, can be called from any thread.
+   *
+   * @tparam EventT
+   * @param event
+   * @param dispatch_to_all
+   */
+  template <typename EventT>
+  void Enqueue(const EventT& event, bool dispatch_to_all = false);
+
+  /**
+   * @brief Dispatch all deferred events.
+   *
+   * Events of the same type are dispatched in the order they were enqueued, there are no ordering
+   * guarantees between events of different types.
+   *
+   * @warning Must be called from a single thread at a time.
+   *
+   * @return Number of dispatched events.
+   */
+  size_t DispatchQueued();
+
  private:
-  std::unordered_map<detail::EventTypeId, std::unique_ptr<detail::IBaseEventSink>> sinks_;
+  std::array<std::atomic<detail::IBaseEventSink*>, kMaxEventTypes> sinks_{};
+  std::atomic<detail::EventTypeId>                                 sinks_end_{0};
 };
 
+inline EventDispatcher::~EventDispatcher() {
+  for (auto& sink : sinks_) {
+    delete sink.load(std::memory_order_acquire);
+  }
+}
+
 template <typename EventT>
 EventSink<EventT>& EventDispatcher::GetSink() {
-  detail::EventTypeId type_id = detail::EventTypeIdHolder<EventT>::Value();
+  const detail::EventTypeId type_id = detail::EventTypeIdHolder<EventT>::Value();
+  LIGER_ASSERT(type_id < kMaxEventTypes, kLogChannelCore, "Too many event types, max supported is {0}",
+               kMaxEventTypes);
 
-  auto it = sinks_.find(type_id);
-  if (it == sinks_.end()) {
-    it = sinks_.emplace(type_id, std::move(std::make_unique<EventSink<EventT>>())).first;
+  detail::IBaseEventSink* sink = sinks_[type_id].load(std::memory_order_acquire);
+  if (sink == nullptr) {
+    auto new_sink = std::make_unique<EventSink<EventT>>();
+
+    if (sinks_[type_id].compare_exchange_strong(sink, new_sink.get(), std::memory_order_acq_rel)) {
+      sink = new_sink.release();
+
+      detail::EventTypeId end = sinks_end_.load(std::memory_order_relaxed);
+      while (end < type_id + 1 && !sinks_end_.compare_exchange_weak(end, type_id + 1, std::memory_order_release)) {
+      }
+    }
   }
 
-  return *dynamic_cast<EventSink<EventT>*>(it->second.get());
+  return *static_cast<EventSink<EventT>*>(sink);
 }
 
 template <typename EventT>
@@ -81,4 +141,22 @@ bool EventDispatcher::Dispatch(const EventT& event, bool dispatch_to_all) {
   return GetSink<EventT>().Dispatch(event, dispatch_to_all);
 }
 
-}  // namespace liger
\ No newline at end of file
+template <typename EventT>
+void EventDispatcher::Enqueue(const EventT& event, bool dispatch_to_all) {
+  GetSink<EventT>().Enqueue(event, dispatch_to_all);
+}
+
+inline size_t EventDispatcher::DispatchQueued() {
+  size_t count = 0;
+
+  const detail::EventTypeId end = sinks_end_.load(std::memory_order_acquire);
+  for (detail::EventTypeId type_id = 0; type_id < end; ++type_id) {
+    if (auto* sink = sinks_[type_id].load(std::memory_order_acquire); sink != nullptr) {
+      count += sink->DispatchQueued();
+    }
+  }
+
+  return count;
+}
+
+}  // namespace liger
@@ -0,0 +1,133 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file EventQueue.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace liger {
+
+/**
+ * @brief Multi-producer single-consumer queue of events.
+ *
+ * Any thread can @ref Enqueue events, the owning thread drains them in a batch via @ref Drain,
+ * which preserves the order in which the events were enqueued.
+ *
+ * Events are appended to a vector which is swapped with a second one on drain, so once both have
+ * grown to the number of events queued per frame, enqueueing does not allocate. The lock is only
+ * held for the append and the swap.
+ *
+ * @tparam EventT Event type.
+ */
+template <typename EventT>
+class EventQueue {
+ public:
+  EventQueue() = default;
+  ~EventQueue() = default;
+
+  EventQueue(const EventQueue& other)            = delete;
+  EventQueue& operator=(const EventQueue& other) = delete;
+
+  EventQueue(EventQueue&& other)            = delete;
+  EventQueue& operator=(EventQueue&& other) = delete;
+
+  /**
+   * @brief Enqueue the event, can be called from any thread.
+   *
+   * @param event
+   * @param dispatch_to_all Whether the event must be dispatched to all callbacks once drained.
+   */
+  void Enqueue(const EventT& event, bool dispatch_to_all = false);
+
+  /**
+   * @brief Whether there are no pending events.
+   */
+  bool Empty() const;
+
+  /**
+   * @brief Remove all pending events and call the function for each of them in the enqueue order.
+   *
+   * Events enqueued by the function are only drained by the next call.
+   *
+   * @warning Must be called from a single thread at a time.
+   *
+   * @param function Callable with the signature void(const EventT& event, bool dispatch_to_all).
+   * @return Number of drained events.
+   */
+  template <typename F>
+  size_t Drain(F&& function);
+
+ private:
+  struct Entry {
+    EventT event;
+    bool   dispatch_to_all{false};
+  };
+
+  mutable std::mutex mutex_;
+  std::vector<Entry> pending_;
+  std::vector<Entry> draining_;
+};
+
+template <typename EventT>
+void EventQueue<EventT>::Enqueue(const EventT& event, bool dispatch_to_all) {
+  std::lock_guard lock(mutex_);
+  pending_.emplace_back(Entry{event, dispatch_to_all});
+}
+
+template <typename EventT>
+bool EventQueue<EventT>::Empty() const {
+  std::lock_guard lock(mutex_);
+  return pending_.empty();
+}
+
+template <typename EventT>
+template <typename F>
+size_t EventQueue<EventT>::Drain(F&& function) {
+  /* Taken out of the member, so that a nested drain from the function does not clear it while it is iterated */
+  std::vector<Entry> draining = std::move(draining_);
+
+  {
+    std::lock_guard lock(mutex_);
+    std::swap(draining, pending_);
+  }
+
+  for (const auto& entry : draining) {
+    function(entry.event, entry.dispatch_to_all);
+  }
+
+  const size_t count = draining.size();
+
+  draining.clear();
+  draining_ = std::move(draining);
+
+  return count;
+}
+
+}  // namespace liger
@@ -29,11 +29,18 @@
 
 #include <Liger-Engine/Core/Event/Detail/BaseEventSink.hpp>
 #include <Liger-Engine/Core/Event/Detail/Callback.hpp>
+#include <Liger-Engine/Core/Event/EventQueue.hpp>
+
+#include <mutex>
+#include <vector>
 
 namespace liger {
 
 /**
  * @brief Event sink for callbacks of the specified event.
+ *
+ * Callbacks can be connected and removed from any thread, also while an event is dispatched,
+ * including from within a callback.
  * 
  * @tparam EventT Event type.
  */
@@ -57,6 +64,8 @@ class EventSink final : public detail::IBaseEventSink {
   void Connect() {
     detail::Callback<CallbackFunctionT> callback;
     callback.template Connect<FunctionT>();
+
+    std::lock_guard lock(mutex_);
     callbacks_.emplace_back(std::move(callback));
   }
 
@@ -71,6 +80,8 @@ class EventSink final : public detail::IBaseEventSink {
   void Connect(ClassT& instance) {
     detail::Callback<CallbackFunctionT> callback;
     callback.template Connect<FunctionT, ClassT>(instance);
+
+    std::lock_guard lock(mutex_);
     callbacks_.emplace_back(std::move(callback));
   }
 
@@ -84,6 +95,7 @@ class EventSink final : public detail::IBaseEventSink {
     detail::Callback<CallbackFunctionT> callback;
     callback.template Connect<FunctionT>();
 
+    std::lock_guard lock(mutex_);
     for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
       if (*it == callback) {
         callbacks_.erase(it);
@@ -104,6 +116,7 @@ class EventSink final : public detail::IBaseEventSink {
     detail::Callback<CallbackFunctionT> callback;
     callback.template Connect<FunctionT, ClassT>(instance);
 
+    std::lock_guard lock(mutex_);
     for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
       if (*it == callback) {
         callbacks_.erase(it);
@@ -123,8 +136,10 @@ class EventSink final : public detail::IBaseEventSink {
   bool Dispatch(const EventT& event, bool dispatch_to_all = false) {
     bool event_handled = false;
 
+    /* Recursive, so that callbacks can connect and remove callbacks of this sink */
+    std::lock_guard lock(mutex_);
     for (size_t i = 0; i < callbacks_.size(); ++i) {
-      event_handled = event_handled || callbacks_[i](event);
+      event_handled = callbacks_[i](event) || event_handled;
 
       if (event_handled && !dispatch_to_all) {
         break;
@@ -134,8 +149,29 @@ class EventSink final : public detail::IBaseEventSink {
     return event_handled;
   }
 
+  /**
+   * @brief Defer the event until the next @ref DispatchQueued call, can be called from any thread.
+   *
+   * @param event
+   * @param dispatch_to_all
+   */
+  void Enqueue(const EventT& event, bool dispatch_to_all = false) {
+    queue_.Enqueue(event, dispatch_to_all);
+  }
+
+  /**
+   * @brief Dispatch all deferred events in the order they were enqueued.
+   *
+   * @return Number of dispatched events.
+   */
+  size_t DispatchQueued() override {
+    return queue_.Drain([this](const EventT& event, bool dispatch_to_all) { Dispatch(event, dispatch_to_all); });
+  }
+
  private:
+  std::recursive_mutex                             mutex_;
   std::vector<detail::Callback<CallbackFunctionT>> callbacks_;
+  EventQueue<EventT>                               queue_;
 };
 
 }  // namespace liger
\ No newline at end of file
@@ -0,0 +1,306 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file Bounds.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace liger {
+
+/**
+ * @brief Result of testing whether a box is inside a query volume.
+ */
+enum class Containment : uint8_t {
+  Outside,
+  Intersects,
+  Inside
+};
+
+/**
+ * @brief Axis-aligned bounding box, default constructed box is empty.
+ */
+struct AABB {
+  static inline AABB FromCenterExtent(const glm::vec3& center, const glm::vec3& extent);
+
+  inline bool Empty() const;
+
+  inline glm::vec3 Center() const;
+
+  /**
+   * @brief Half of the box size.
+   */
+  inline glm::vec3 Extent() const;
+
+  inline float SurfaceArea() const;
+
+  inline void Expand(const glm::vec3& point);
+  inline void Expand(const AABB& box);
+
+  inline AABB Enlarged(const glm::vec3& margin) const;
+
+  /**
+   * @brief Box enclosing this box transformed by the affine matrix.
+   */
+  inline AABB Transformed(const glm::mat4& matrix) const;
+
+  inline bool Contains(const AABB& other) const;
+  inline bool Overlaps(const AABB& other) const;
+
+  inline Containment Classify(const AABB& box) const;
+
+  bool operator==(const AABB& other) const = default;
+
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+};
+
+inline AABB Union(const AABB& lhs, const AABB& rhs) {
+  return AABB{.min = glm::min(lhs.min, rhs.min), .max = glm::max(lhs.max, rhs.max)};
+}
+
+struct Sphere {
+  inline bool Overlaps(const AABB& box) const;
+
+  inline Containment Classify(const AABB& box) const;
+
+  glm::vec3 center{0.0f};
+  float     radius{0.0f};
+};
+
+/**
+ * @brief Ray, distances along it are measured in units of the direction's length.
+ */
+struct Ray {
+  inline glm::vec3 InverseDirection() const;
+
+  /**
+   * @brief Slab test against the box.
+   *
+   * @param inverse_direction Result of @ref InverseDirection, precomputed to test many boxes.
+   * @param max_distance      Max distance along the ray.
+   * @param distance          Distance at which the ray enters the box, 0 if the origin is inside.
+   *
+   * @return Whether the ray hits the box within max_distance.
+   */
+  inline bool Intersect(const AABB& box, const glm::vec3& inverse_direction, float max_distance,
+                        float& distance) const;
+
+  glm::vec3 origin{0.0f};
+  glm::vec3 direction{0.0f, 0.0f, -1.0f};
+};
+
+/**
+ * @brief View frustum as 6 planes (normal, distance), points p with dot(normal, p) + distance >= 0 are inside.
+ */
+struct Frustum {
+  /**
+   * @brief Extract the planes from a view-projection matrix with [-1, 1] clip space depth (glm's default).
+   */
+  static inline Frustum FromMatrix(const glm::mat4& view_projection);
+
+  inline bool Overlaps(const AABB& box) const;
+  inline bool Overlaps(const Sphere& sphere) const;
+
+  /**
+   * @brief Conservative test, boxes near the frustum's corners may be reported as intersecting.
+   */
+  inline Containment Classify(const AABB& box) const;
+
+  std::array<glm::vec4, 6U> planes;
+};
+
+/************************************************************************************************
+ * AABB
+ ************************************************************************************************/
+inline AABB AABB::FromCenterExtent(const glm::vec3& center, const glm::vec3& extent) {
+  return AABB{.min = center - extent, .max = center + extent};
+}
+
+inline bool AABB::Empty() const {
+  return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+inline glm::vec3 AABB::Center() const {
+  return 0.5f * (min + max);
+}
+
+inline glm::vec3 AABB::Extent() const {
+  return 0.5f * (max - min);
+}
+
+inline float AABB::SurfaceArea() const {
+  const glm::vec3 size = max - min;
+  return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+inline void AABB::Expand(const glm::vec3& point) {
+  min = glm::min(min, point);
+  max = glm::max(max, point);
+}
+
+inline void AABB::Expand(const AABB& box) {
+  min = glm::min(min, box.min);
+  max = glm::max(max, box.max);
+}
+
+inline AABB AABB::Enlarged(const glm::vec3& margin) const {
+  return AABB{.min = min - margin, .max = max + margin};
+}
+
+/**
+ * The transformed center plus the extent projected onto each axis (Arvo's method), which is
+ * exact for the box's transformed corners.
+ */
+inline AABB AABB::Transformed(const glm::mat4& matrix) const {
+  const glm::vec3 center = glm::vec3(matrix * glm::vec4(Center(), 1.0f));
+  const glm::vec3 extent = Extent();
+
+  const glm::vec3 transformed_extent = glm::abs(glm::vec3(matrix[0])) * extent.x +
+                                       glm::abs(glm::vec3(matrix[1])) * extent.y +
+                                       glm::abs(glm::vec3(matrix[2])) * extent.z;
+
+  return FromCenterExtent(center, transformed_extent);
+}
+
+inline bool AABB::Contains(const AABB& other) const {
+  return glm::all(glm::lessThanEqual(min, other.min)) && glm::all(glm::lessThanEqual(other.max, max));
+}
+
+inline bool AABB::Overlaps(const AABB& other) const {
+  return glm::all(glm::lessThanEqual(min, other.max)) && glm::all(glm::lessThanEqual(other.min, max));
+}
+
+inline Containment AABB::Classify(const AABB& box) const {
+  if (!Overlaps(box)) {
+    return Containment::Outside;
+  }
+
+  return Contains(box) ? Containment::Inside : Containment::Intersects;
+}
+
+/************************************************************************************************
+ * Sphere
+ ************************************************************************************************/
+inline bool Sphere::Overlaps(const AABB& box) const {
+  const glm::vec3 offset = glm::clamp(center, box.min, box.max) - center;
+  return glm::dot(offset, offset) <= radius * radius;
+}
+
+inline Containment Sphere::Classify(const AABB& box) const {
+  if (!Overlaps(box)) {
+    return Containment::Outside;
+  }
+
+  const glm::vec3 farthest = glm::max(glm::abs(box.min - center), glm::abs(box.max - center));
+  return glm::dot(farthest, farthest) <= radius * radius ? Containment::Inside : Containment::Intersects;
+}
+
+/************************************************************************************************
+ * Ray
+ ************************************************************************************************/
+inline glm::vec3 Ray::InverseDirection() const {
+  return 1.0f / direction;
+}
+
+inline bool Ray::Intersect(const AABB& box, const glm::vec3& inverse_direction, float max_distance,
+                           float& distance) const {
+  const glm::vec3 t0 = (box.min - origin) * inverse_direction;
+  const glm::vec3 t1 = (box.max - origin) * inverse_direction;
+
+  const glm::vec3 t_near = glm::min(t0, t1);
+  const glm::vec3 t_far  = glm::max(t0, t1);
+
+  const float enter = glm::max(glm::max(t_near.x, t_near.y), glm::max(t_near.z, 0.0f));
+  const float exit  = glm::min(glm::min(t_far.x, t_far.y), glm::min(t_far.z, max_distance));
+
+  distance = enter;
+  return enter <= exit;
+}
+
+/************************************************************************************************
+ * Frustum
+ ************************************************************************************************/
+/**
+ * Gribb-Hartmann extraction, each plane is a sum or difference of the matrix's last row and one
+ * of the others. Planes are normalized, so that sphere tests can use the signed distance.
+ */
+inline Frustum Frustum::FromMatrix(const glm::mat4& view_projection) {
+  const glm::mat4 rows = glm::transpose(view_projection);
+
+  Frustum frustum;
+  frustum.planes = {rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+                    rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2]};
+
+  for (auto& plane : frustum.planes) {
+    plane /= glm::length(glm::vec3(plane));
+  }
+
+  return frustum;
+}
+
+inline bool Frustum::Overlaps(const AABB& box) const {
+  return Classify(box) != Containment::Outside;
+}
+
+inline bool Frustum::Overlaps(const Sphere& sphere) const {
+  for (const auto& plane : planes) {
+    if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+inline Containment Frustum::Classify(const AABB& box) const {
+  const glm::vec3 center = box.Center();
+  const glm::vec3 extent = box.Extent();
+
+  auto result = Containment::Inside;
+  for (const auto& plane : planes) {
+    const glm::vec3 normal = glm::vec3(plane);
+
+    const float distance = glm::dot(normal, center) + plane.w;
+    const float radius   = glm::dot(glm::abs(normal), extent);
+
+    if (distance < -radius) {
+      return Containment::Outside;
+    }
+
+    if (distance < radius) {
+      result = Containment::Intersects;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace liger
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/Math/Bounds.hpp>
 #include <Liger-Engine/Core/Math/Formatting.hpp>
 #include <Liger-Engine/Core/Math/Random.hpp>
-#include <Liger-Engine/Core/Math/Transform3D.hpp>
\ No newline at end of file
+#include <Liger-Engine/Core/Math/Transform3D.hpp>
+#include <Liger-Engine/Core/Math/TransformBatch.hpp>
\ No newline at end of file
@@ -54,6 +54,7 @@ struct Transform3D {
 
   inline glm::mat4 Matrix() const;
   inline glm::mat4 InverseMatrix() const;
+  inline glm::mat3 NormalMatrix() const;
 
   inline glm::vec3 Forward() const;
   inline glm::vec3 Up() const;
@@ -61,6 +62,17 @@ struct Transform3D {
 
   inline void Rotate(float angle, const glm::vec3& axis);
 
+  /**
+   * @brief Combine with a transform relative to this one, e.g. parent.Combine(child_local).
+   * @warning Shear produced by non-uniform scale combined with rotation is dropped.
+   */
+  inline Transform3D Combine(const Transform3D& local) const;
+
+  /**
+   * @brief Exact comparison, used to detect whether a transform has been modified.
+   */
+  bool operator==(const Transform3D& other) const = default;
+
   glm::vec3 position{0.0f};
   glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
   glm::vec3 scale{1.0f};
@@ -92,8 +104,15 @@ inline glm::mat4 Transform3D::ScaleMatrix() const {
   return glm::scale(glm::identity<glm::mat4>(), scale);
 }
 
+/**
+ * Composes T * R * S directly, column i of the result is column i of the rotation
+ * matrix scaled by scale[i], the last column is the translation.
+ */
 inline glm::mat4 Transform3D::Matrix() const {
-  return TranslationMatrix() * RotationMatrix() * ScaleMatrix();
+  const glm::mat3 rotation_matrix = glm::mat3_cast(rotation);
+
+  return glm::mat4{glm::vec4{rotation_matrix[0] * scale.x, 0.0f}, glm::vec4{rotation_matrix[1] * scale.y, 0.0f},
+                   glm::vec4{rotation_matrix[2] * scale.z, 0.0f}, glm::vec4{position, 1.0f}};
 }
 
 /**
@@ -110,8 +129,28 @@ inline glm::mat4 Transform3D::Matrix() const {
  * of negative values of the given translation.
  */
 inline glm::mat4 Transform3D::InverseMatrix() const {
-  const auto identity = glm::identity<glm::mat4>();
-  return glm::scale(identity, 1.0f / scale) * glm::transpose(RotationMatrix()) * glm::translate(identity, -position);
+  const glm::vec3 inv_scale = 1.0f / scale;
+
+  glm::mat3 linear = glm::transpose(glm::mat3_cast(rotation));
+  linear[0] *= inv_scale;
+  linear[1] *= inv_scale;
+  linear[2] *= inv_scale;
+
+  return glm::mat4{glm::vec4{linear[0], 0.0f}, glm::vec4{linear[1], 0.0f}, glm::vec4{linear[2], 0.0f},
+                   glm::vec4{-(linear * position), 1.0f}};
+}
+
+/**
+ * Normal matrix is the inverse transpose of the upper-left 3x3 part:
+ * ((R * S)^-1)^T = (S^-1 * R^T)^T = R * S^-1
+ */
+inline glm::mat3 Transform3D::NormalMatrix() const {
+  glm::mat3 normal_matrix = glm::mat3_cast(rotation);
+  normal_matrix[0] /= scale.x;
+  normal_matrix[1] /= scale.y;
+  normal_matrix[2] /= scale.z;
+
+  return normal_matrix;
 }
 
 inline glm::vec3 Transform3D::Forward() const { return rotation * glm::vec4(kForward, 1.0f); }
@@ -122,4 +161,13 @@ inline void Transform3D::Rotate(float angle, const glm::vec3& axis) {
   rotation = glm::angleAxis(angle, axis) * rotation;
 }
 
+inline Transform3D Transform3D::Combine(const Transform3D& local) const {
+  Transform3D result;
+  result.position = position + rotation * (scale * local.position);
+  result.rotation = rotation * local.rotation;
+  result.scale    = scale * local.scale;
+
+  return result;
+}
+
 }  // namespace liger
\ No newline at end of file
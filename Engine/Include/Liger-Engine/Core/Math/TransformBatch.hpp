@@ -0,0 +1,91 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file TransformBatch.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Math/Transform3D.hpp>
+
+#include <cstddef>
+#include <span>
+
+namespace liger {
+
+/**
+ * @brief Structure-of-arrays view of transforms, each array must contain at least `count` elements.
+ */
+struct Transform3DSoA {
+  const float* position_x;
+  const float* position_y;
+  const float* position_z;
+
+  const float* rotation_x;
+  const float* rotation_y;
+  const float* rotation_z;
+  const float* rotation_w;
+
+  const float* scale_x;
+  const float* scale_y;
+  const float* scale_z;
+
+  size_t count;
+};
+
+/**
+ * @brief Batch transform kernels.
+ *
+ * Compose matrices directly from translation, rotation and scale without any intermediate matrix
+ * multiplications. Computations are done in a SIMD structure-of-arrays fashion, 8 transforms at a
+ * time with AVX2, 4 with SSE4.1, otherwise falling back to scalar code.
+ *
+ * Output matrices are written with the byte stride `out_stride`, so that they can be written
+ * directly into arrays of bigger structures (e.g. GPU object data).
+ */
+namespace transform_batch {
+
+/**
+ * @brief Calculate T * R * S matrices, same as @ref Transform3D::Matrix.
+ */
+void ComposeMatrices(std::span<const Transform3D> transforms, glm::mat4* out, size_t out_stride = sizeof(glm::mat4));
+void ComposeMatrices(const Transform3DSoA& transforms, glm::mat4* out, size_t out_stride = sizeof(glm::mat4));
+
+/**
+ * @brief Calculate S^-1 * R^T * T^-1 matrices, same as @ref Transform3D::InverseMatrix.
+ */
+void ComposeInverseMatrices(std::span<const Transform3D> transforms, glm::mat4* out,
+                            size_t out_stride = sizeof(glm::mat4));
+void ComposeInverseMatrices(const Transform3DSoA& transforms, glm::mat4* out, size_t out_stride = sizeof(glm::mat4));
+
+/**
+ * @brief Calculate normal matrices (R * S^-1), same as @ref Transform3D::NormalMatrix.
+ */
+void ComposeNormalMatrices(std::span<const Transform3D> transforms, glm::mat3* out,
+                           size_t out_stride = sizeof(glm::mat3));
+void ComposeNormalMatrices(const Transform3DSoA& transforms, glm::mat3* out, size_t out_stride = sizeof(glm::mat3));
+
+}  // namespace transform_batch
+
+}  // namespace liger
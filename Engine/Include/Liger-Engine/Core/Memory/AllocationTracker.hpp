@@ -0,0 +1,103 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file AllocationTracker.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace liger {
+
+/**
+ * @brief Counts heap allocations made through global operator new on all threads.
+ *
+ * The operator new/delete replacements are only compiled in with LIGER_TRACK_ALLOCATIONS
+ * (cmake option of the same name), otherwise tracking is unavailable and reports are empty.
+ * Each allocation made while tracking is attributed to its call stack, so that hidden
+ * allocations in per-frame code can be found.
+ */
+class AllocationTracker {
+ public:
+  static constexpr uint32_t kMaxCallSites  = 256U;
+  static constexpr uint32_t kMaxStackDepth = 12U;
+
+  struct CallSite {
+    std::array<void*, kMaxStackDepth> stack{};
+    uint32_t                          depth{0U};
+
+    uint64_t                          allocations{0U};
+    uint64_t                          bytes{0U};
+  };
+
+  struct Report {
+    uint64_t              allocations{0U};
+    uint64_t              bytes{0U};
+
+    /* Allocations, whose call sites did not fit into kMaxCallSites */
+    uint64_t              untracked_call_site_allocations{0U};
+
+    std::vector<CallSite> call_sites;
+  };
+
+  /**
+   * @brief Whether the engine has been built with LIGER_TRACK_ALLOCATIONS.
+   */
+  static bool Available();
+
+  /**
+   * @brief Reset counters and start tracking allocations.
+   */
+  static void Start();
+
+  /**
+   * @brief Stop tracking allocations.
+   * @return Allocations made since @ref Start(), call sites are sorted by allocation count.
+   */
+  static Report Stop();
+
+  /**
+   * @brief Log the report along with symbolized call stacks (where supported by the platform).
+   */
+  static void LogReport(const Report& report, const char* channel);
+
+  /**
+   * @brief Run warm-up frames, then check that the measured frames do not allocate.
+   *
+   * @param warmup_frames   Frames to run before tracking, e.g. to let containers reach their capacity.
+   * @param measured_frames Frames to run while tracking.
+   * @param run_frame       Runs a single frame.
+   *
+   * @return Whether no allocations have been made in the measured frames, the offending
+   *         call sites are logged otherwise.
+   */
+  static bool CheckSteadyState(uint32_t warmup_frames, uint32_t measured_frames,
+                               const std::function<void()>& run_frame);
+};
+
+}  // namespace liger
@@ -0,0 +1,89 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FrameAllocator.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Memory/LinearArena.hpp>
+
+#include <vector>
+
+namespace liger {
+
+/**
+ * @brief Per-thread linear arenas for transient data living no longer than a frame.
+ *
+ * Each thread allocates from its own @ref LinearArena, so no synchronization is needed. Calling
+ * @ref BeginFrame() invalidates every allocation made during the previous frame on all threads,
+ * each thread's arena is reset lazily on its next allocation.
+ */
+class FrameArena {
+ public:
+  /**
+   * @brief Start a new frame, must not be called while other threads are using frame memory.
+   */
+  static void BeginFrame();
+
+  /**
+   * @brief The calling thread's arena, reset if a new frame has started since its last use.
+   */
+  static LinearArena& Get();
+
+  [[nodiscard]] static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+};
+
+/**
+ * @brief STL allocator adaptor over @ref FrameArena.
+ *
+ * Stateless, so containers can grow on any thread. Deallocation is a no-op, hence reserve
+ * the capacity up front where possible.
+ */
+template <typename T>
+class FrameAllocator {
+ public:
+  using value_type = T;
+
+  FrameAllocator() noexcept = default;
+
+  template <typename U>
+  FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+  [[nodiscard]] T* allocate(size_t count) {
+    return static_cast<T*>(FrameArena::Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, size_t) noexcept {}
+
+  template <typename U>
+  bool operator==(const FrameAllocator<U>&) const noexcept {
+    return true;
+  }
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+}  // namespace liger
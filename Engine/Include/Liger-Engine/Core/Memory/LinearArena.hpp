@@ -0,0 +1,100 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file LinearArena.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace liger {
+
+/**
+ * @brief Bump allocator, which frees all of its allocations at once on @ref Reset().
+ *
+ * Memory is taken from a chain of blocks. Upon reset the chain is replaced with a single block
+ * large enough to fit everything allocated since the last reset, so that a steady workload
+ * ends up allocating from one block without touching the heap. Not thread-safe.
+ */
+class LinearArena {
+ public:
+  static constexpr size_t kDefaultBlockSize = 64U * 1024U;
+
+  explicit LinearArena(size_t block_size = kDefaultBlockSize);
+  ~LinearArena();
+
+  LinearArena(const LinearArena& other) = delete;
+  LinearArena& operator=(const LinearArena& other) = delete;
+
+  LinearArena(LinearArena&& other) = delete;
+  LinearArena& operator=(LinearArena&& other) = delete;
+
+  /**
+   * @brief Allocate memory, which stays valid until the next @ref Reset().
+   *
+   * @param size      Size in bytes.
+   * @param alignment Alignment, must be a power of two.
+   */
+  [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * @brief Invalidate all allocations made since the last reset.
+   */
+  void Reset();
+
+  /**
+   * @brief Bytes allocated since the last reset, including alignment padding.
+   */
+  size_t Used() const;
+
+  /**
+   * @brief Total size of the blocks currently owned by the arena.
+   */
+  size_t Capacity() const;
+
+ private:
+  struct alignas(std::max_align_t) Block {
+    Block* prev;
+    size_t size;
+
+    std::byte* Begin() { return reinterpret_cast<std::byte*>(this + 1); }
+    std::byte* End() { return Begin() + size; }
+  };
+
+  void PushBlock(size_t min_size);
+  void ReleaseBlocks();
+
+  size_t     block_size_;
+
+  Block*     current_{nullptr};
+  std::byte* cursor_{nullptr};
+  std::byte* end_{nullptr};
+
+  size_t     used_{0U};
+  size_t     capacity_{0U};
+};
+
+}  // namespace liger
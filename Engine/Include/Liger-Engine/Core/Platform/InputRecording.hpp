@@ -0,0 +1,128 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file InputRecording.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Event/EventDispatcher.hpp>
+#include <Liger-Engine/Core/Platform/Keyboard.hpp>
+#include <Liger-Engine/Core/Platform/Mouse.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace liger {
+
+class PlatformLayer;
+
+/**
+ * @brief Records the input event stream along with per-frame delta times.
+ *
+ * Attach to the platform layer with @ref PlatformLayer::SetInputRecorder and call @ref BeginFrame
+ * every frame before @ref PlatformLayer::PollEvents. Events are only recorded once the first frame
+ * has begun.
+ */
+class InputRecorder {
+ public:
+  void BeginFrame(float delta_time);
+
+  void Record(const KeyEvent& event);
+  void Record(const MouseMoveEvent& event);
+  void Record(const MouseButtonEvent& event);
+  void Record(const MouseScrollEvent& event);
+
+  uint32_t FrameCount() const;
+
+  /**
+   * @brief Save the recording to a binary file.
+   * @return Whether successfully saved.
+   */
+  bool Save(const std::filesystem::path& filepath) const;
+
+ private:
+  template <typename T>
+  void Write(const T& value);
+
+  template <typename EventT>
+  void RecordEvent(uint8_t type, const EventT& event);
+
+  std::vector<uint8_t> data_;
+  uint32_t             frame_count_{0U};
+  size_t               event_count_offset_{0U};
+};
+
+/**
+ * @brief Feeds a recording made by @ref InputRecorder back through the platform layer.
+ *
+ * While replaying, live input is ignored by the platform layer and @ref PlatformLayer::KeyPressed
+ * reports the replayed key state, so the same recording always produces the same input.
+ */
+class InputReplayer {
+ public:
+  /**
+   * @brief Load the recording.
+   * @return Whether the file is a valid recording.
+   */
+  bool Load(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Use the timestep for all frames instead of the recorded delta times.
+   */
+  void SetFixedTimestep(std::optional<float> timestep);
+
+  /**
+   * @brief Enqueue the next frame's events into the platform layer, call before @ref PlatformLayer::PollEvents.
+   * @return Timestep of the frame.
+   */
+  float NextFrame(PlatformLayer& platform);
+
+  /**
+   * @brief Enqueue the next frame's events into the dispatcher, e.g. for headless replays without a platform layer.
+   * @return Timestep of the frame.
+   */
+  float NextFrame(EventDispatcher& dispatcher);
+
+  bool Finished() const;
+
+  uint32_t FrameCount() const;
+  uint32_t CurrentFrame() const;
+
+ private:
+  template <typename T>
+  bool Read(T& value);
+
+  template <typename EventCallback>
+  float ReplayFrame(EventCallback&& callback);
+
+  std::vector<uint8_t> data_;
+  size_t               cursor_{0U};
+  uint32_t             frame_count_{0U};
+  uint32_t             current_frame_{0U};
+  std::optional<float> fixed_timestep_;
+};
+
+}  // namespace liger
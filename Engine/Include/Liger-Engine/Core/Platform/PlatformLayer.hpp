@@ -32,12 +32,19 @@
 #include <Liger-Engine/Core/Platform/Mouse.hpp>
 #include <Liger-Engine/Core/Platform/Window.hpp>
 
+#include <bitset>
+
 namespace liger {
 
+class InputRecorder;
+
 class PlatformLayer {
  public:
   static PlatformLayer& Instance();
 
+  /**
+   * @brief Poll window system events and dispatch all events queued since the last call.
+   */
   void PollEvents();
 
   template <typename EventT>
@@ -45,6 +52,14 @@ class PlatformLayer {
     return dispatcher_.GetSink<EventT>();
   }
 
+  /**
+   * @brief Defer the event until the next @ref PollEvents call, can be called from any thread.
+   */
+  template <typename EventT>
+  void Enqueue(const EventT& event, bool dispatch_to_all = false) {
+    dispatcher_.Enqueue(event, dispatch_to_all);
+  }
+
   /************************************************************************************************
    * Window
    ************************************************************************************************/
@@ -58,6 +73,19 @@ class PlatformLayer {
   glm::vec2 GetCursorPosition(Window* window) const;
   void SetCursorEnabled(Window* window, bool enabled);
 
+  /**
+   * @brief Record all input events coming from windows, nullptr stops recording.
+   */
+  void SetInputRecorder(InputRecorder* recorder);
+
+  /**
+   * @brief Ignore live input and report the replayed key state instead, see @ref InputReplayer.
+   */
+  void SetInputReplay(bool enabled);
+  bool InputReplay() const;
+
+  void SetReplayedKeyState(Key key, bool pressed);
+
  private:
    PlatformLayer();
    ~PlatformLayer();
@@ -71,10 +99,17 @@ class PlatformLayer {
   static void MouseMoveCallback(GLFWwindow* window, double x, double y);
   static void MouseButtonCallback(GLFWwindow* window, int32_t button, int32_t action, int32_t mods);
 
+  template <typename EventT>
+  void PushInputEvent(const EventT& event);
+
   EventDispatcher                            dispatcher_;
   std::unordered_map<GLFWwindow*, glm::vec2> prev_mouse_pos_;
   std::unordered_map<GLFWwindow*, Window*>   window_wrapper_;
 
+  InputRecorder*                             recorder_{nullptr};
+  bool                                       replay_{false};
+  std::bitset<GLFW_KEY_LAST + 1>             replayed_keys_;
+
   static PlatformLayer instance_;
 };
 
@@ -0,0 +1,137 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FrameTaskGraph.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Containers/DependencyGraph.hpp>
+#include <Liger-Engine/Core/Time.hpp>
+
+#include <taskflow/taskflow.hpp>
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace liger {
+
+enum class TaskPriority : uint8_t {
+  High,
+  Normal,
+  Low
+};
+
+/**
+ * @brief Task graph of a whole frame, run on a shared work-stealing executor.
+ *
+ * Tasks are callables with declared dependencies, e.g. ECS systems, render features' PreRender/PostRender
+ * and render graph submission. The graph is built once and rerun every frame. The timings of all tasks
+ * in the last run are recorded, so that the critical path of the frame can be inspected.
+ *
+ * Priorities order the tasks which become ready at the same time: tasks without dependencies and the
+ * successors of a task are scheduled in priority order. This is best effort, the executor does not
+ * guarantee that a higher priority task starts first.
+ */
+class FrameTaskGraph {
+ public:
+  using TaskId   = DAG<void>::NodeHandle;
+  using TaskWork = std::function<void()>;
+
+  struct TaskTiming {
+    /** Time since the beginning of the last run */
+    float   begin_ms{0.0f};
+    float   duration_ms{0.0f};
+
+    /** Executor worker, -1 if the task has not been run by a worker */
+    int32_t worker{-1};
+  };
+
+  explicit FrameTaskGraph(std::string name = "Frame");
+
+  FrameTaskGraph(const FrameTaskGraph& other)            = delete;
+  FrameTaskGraph& operator=(const FrameTaskGraph& other) = delete;
+
+  TaskId Emplace(std::string name, TaskWork work, TaskPriority priority = TaskPriority::Normal);
+
+  /**
+   * @brief Run the taskflow as a single task, its tasks are co-run on the same executor.
+   * @warning The taskflow must outlive the graph.
+   */
+  TaskId Compose(std::string name, tf::Taskflow& taskflow, TaskPriority priority = TaskPriority::Normal);
+
+  /**
+   * @brief Empty task, e.g. to mark the end of a frame stage.
+   */
+  TaskId Marker(std::string name);
+
+  /**
+   * @brief Make @p after depend on @p before.
+   */
+  void Precede(TaskId before, TaskId after);
+
+  /**
+   * @brief Run all tasks and wait for them to complete.
+   *
+   * Can be called from a worker of the executor, in which case the worker takes part in running the tasks.
+   */
+  void Run(tf::Executor& executor);
+
+  size_t Size() const;
+
+  std::string_view TaskName(TaskId task) const;
+
+  const TaskTiming& LastTiming(TaskId task) const;
+
+  /**
+   * @brief The longest chain of dependent tasks by their durations in the last run.
+   */
+  std::vector<TaskId> CriticalPath() const;
+
+  void DumpGraphviz(std::ostream& os);
+
+ private:
+  struct Task {
+    std::string  name;
+    TaskWork     work;
+    TaskPriority priority{TaskPriority::Normal};
+  };
+
+  void Build();
+
+  std::string             name_;
+  std::vector<Task>       tasks_;
+  DAG<void>               dag_;
+
+  tf::Taskflow            taskflow_;
+  bool                    dirty_{true};
+
+  tf::Executor*           executor_{nullptr};
+  Timer                   run_timer_;
+  std::vector<TaskTiming> timings_;
+};
+
+}  // namespace liger
@@ -27,8 +27,14 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/Event/EventSink.hpp>
+
+#include <array>
 #include <chrono>
+#include <functional>
+#include <limits>
 #include <string>
+#include <vector>
 
 namespace liger {
 
@@ -85,11 +91,65 @@ class ScopedTimer {
   Timer       timer_;
 };
 
+/**
+ * @brief Coarse phases of a frame, timed with @ref FrameTimer::BeginPhase and @ref FrameTimer::EndPhase.
+ */
+enum class FramePhase : uint8_t {
+  Simulation,
+  RenderPrep,
+  Submit,
+  PresentWait,
+};
+
+constexpr uint32_t kFramePhaseCount = 4U;
+
+/**
+ * @brief Fired by @ref FrameTimer once a frame exceeds one of the hitch thresholds.
+ */
+struct FrameHitchEvent {
+  uint64_t                            frame_number;
+  float                               frame_time_ms;
+  float                               median_frame_time_ms;
+  std::array<float, kFramePhaseCount> phase_times_ms;
+};
+
 /**
 * @brief Utility class for measuring frame time.
 */
 class FrameTimer {
  public:
+  static constexpr uint32_t kDefaultWindowSize = 256U;
+
+  /**
+   * @brief Frame time statistics over the rolling window.
+   */
+  struct Statistics {
+    float    p50_ms{0.0f};
+    float    p95_ms{0.0f};
+    float    p99_ms{0.0f};
+    float    max_ms{0.0f};
+    float    mean_ms{0.0f};
+    uint32_t frame_count{0U};
+  };
+
+  /**
+   * @brief A frame is a hitch if it is longer than either of the thresholds, zero disables a threshold.
+   */
+  struct HitchThresholds {
+    float absolute_ms{50.0f};
+    float relative_to_median{2.5f};
+  };
+
+  /**
+   * @brief Called before dispatching @ref FrameHitchEvent, e.g. to trigger a profiler capture.
+   */
+  using CaptureHook = std::function<void(const FrameHitchEvent&)>;
+
+  /**
+   * @param window_size Number of last frames statistics are calculated over.
+   */
+  explicit FrameTimer(uint32_t window_size = kDefaultWindowSize);
+
   /**
    * @brief Time point at which current frame started.
    * @return Time point in seconds.
@@ -138,17 +198,83 @@ class FrameTimer {
   bool FirstFrame() const;
 
   /**
-   * @brief Proceed to the next frame.
+   * @brief Proceed to the next frame, finishing statistics and hitch detection of the previous one.
    */
   void BeginFrame();
 
+  /**
+   * @brief Start timing the phase in the current frame, a phase can be timed several times per frame.
+   *
+   * @note Different phases can be timed concurrently, e.g. when simulation overlaps with render preparation.
+   */
+  void BeginPhase(FramePhase phase);
+
+  /**
+   * @brief Stop timing the phase started by @ref BeginPhase.
+   */
+  void EndPhase(FramePhase phase);
+
+  /**
+   * @brief Time spent in the phase during the previous frame.
+   * @return Time in milliseconds.
+   */
+  float PhaseTimeMs(FramePhase phase) const;
+
+  /**
+   * @brief Calculate frame time percentiles over the rolling window.
+   */
+  Statistics CalculateStatistics() const;
+
+  void SetHitchThresholds(const HitchThresholds& thresholds);
+  const HitchThresholds& GetHitchThresholds() const;
+
+  void SetCaptureHook(CaptureHook hook);
+
+  /**
+   * @brief Sink of @ref FrameHitchEvent, dispatched to all callbacks from @ref BeginFrame.
+   */
+  EventSink<FrameHitchEvent>& GetHitchSink();
+
  private:
   static constexpr uint64_t kUndefinedFrameNumber = std::numeric_limits<uint64_t>::max();
 
-  Timer    timer_;
-  uint64_t frame_number_{kUndefinedFrameNumber};
-  float    absolute_time_{0.0f};
-  float    delta_time_{0.0f};
+  /* Min number of frames in the window before the relative hitch threshold is used */
+  static constexpr uint32_t kMinFramesForMedian = 16U;
+
+  void EndFrame();
+  float Percentile(float percent) const;
+
+  Timer                               timer_;
+  uint64_t                            frame_number_{kUndefinedFrameNumber};
+  float                               absolute_time_{0.0f};
+  float                               delta_time_{0.0f};
+
+  uint32_t                            window_size_;
+  std::vector<float>                  frame_times_ms_;
+  uint32_t                            frame_times_next_{0U};
+  mutable std::vector<float>          sorted_frame_times_ms_;
+  mutable bool                        sorted_dirty_{true};
+
+  std::array<float, kFramePhaseCount> phase_begin_{};
+  std::array<float, kFramePhaseCount> current_phase_times_ms_{};
+  std::array<float, kFramePhaseCount> last_phase_times_ms_{};
+
+  HitchThresholds                     hitch_thresholds_;
+  CaptureHook                         capture_hook_;
+  EventSink<FrameHitchEvent>          hitch_sink_;
+};
+
+/**
+ * @brief Times the frame phase for the lifetime of the object.
+ */
+class ScopedFramePhase {
+ public:
+  ScopedFramePhase(FrameTimer& frame_timer, FramePhase phase);
+  ~ScopedFramePhase();
+
+ private:
+  FrameTimer& frame_timer_;
+  FramePhase  phase_;
 };
 
 }  // namespace liger
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file TypeSlot.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace liger {
+
+using TypeSlotId = uint32_t;
+
+namespace detail {
+
+template <typename Family>
+struct TypeSlotGenerator {
+  static TypeSlotId NextId() {
+    static std::atomic<TypeSlotId> id{0};
+    return id.fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Dense zero-based per-family type index.
+ *
+ * Each type gets a stable slot id within the @ref Family upon first use, which makes it possible to
+ * store per-type data in a flat array instead of hashing @p std::type_index on every access.
+ *
+ * @tparam Family Tag type, slot ids of different families are independent.
+ * @tparam T      Type to get the slot id for.
+ */
+template <typename Family, typename T>
+struct TypeSlot {
+  static TypeSlotId Value() {
+    static const TypeSlotId kId = detail::TypeSlotGenerator<Family>::NextId();
+    return kId;
+  }
+};
+
+}  // namespace liger
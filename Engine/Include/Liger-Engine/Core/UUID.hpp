@@ -27,13 +27,49 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
 #include <concepts>
 #include <cstdint>
 #include <memory>
-#include <random>
+#include <span>
 
 namespace liger {
 
+namespace detail {
+
+/**
+ * @brief xoshiro256** generator used for UUIDs.
+ */
+class UUIDEngine {
+ public:
+  explicit UUIDEngine(uint64_t seed);
+
+  uint64_t operator()() {
+    const uint64_t result = std::rotl(state_[1U] * 5U, 7) * 9U;
+    const uint64_t t      = state_[1U] << 17U;
+
+    state_[2U] ^= state_[0U];
+    state_[3U] ^= state_[1U];
+    state_[1U] ^= state_[2U];
+    state_[0U] ^= state_[3U];
+    state_[2U] ^= t;
+    state_[3U]  = std::rotl(state_[3U], 45);
+
+    return result;
+  }
+
+ private:
+  std::array<uint64_t, 4U> state_;
+};
+
+/**
+ * @brief Generator of the calling thread, seeded once per thread, so that generation is lock-free.
+ */
+UUIDEngine& ThisThreadUUIDEngine();
+
+}  // namespace detail
+
 template <std::unsigned_integral IntegerType = uint64_t>
 class BasicUUID {
  public:
@@ -47,8 +83,16 @@ class BasicUUID {
   constexpr IntegerType Value() const;
   constexpr IntegerType operator*() const;
 
+  /**
+   * @brief Generate a random valid UUID, thread-safe and lock-free.
+   */
   static BasicUUID<IntegerType> Generate();
 
+  /**
+   * @brief Fill the span with random valid UUIDs, cheaper than calling @ref Generate for each.
+   */
+  static void GenerateN(std::span<BasicUUID<IntegerType>> uuids);
+
  private:
   IntegerType value_{kInvalidValue};
 };
@@ -58,7 +102,7 @@ constexpr BasicUUID<IntegerType>::BasicUUID(IntegerType value) : value_(value) {
 
 template <std::unsigned_integral IntegerType>
 constexpr bool BasicUUID<IntegerType>::Valid() const {
-  return value_ == kInvalidValue;
+  return value_ != kInvalidValue;
 }
 
 template <std::unsigned_integral IntegerType>
@@ -83,11 +127,28 @@ constexpr bool operator!=(BasicUUID<IntegerType> lhs, BasicUUID<IntegerType> rhs
 
 template <std::unsigned_integral IntegerType>
 BasicUUID<IntegerType> BasicUUID<IntegerType>::Generate() {
-  static std::random_device                         random_device;
-  static std::mt19937_64                            random_engine{random_device()};
-  static std::uniform_int_distribution<IntegerType> uniform_distribution;
+  auto& engine = detail::ThisThreadUUIDEngine();
+
+  IntegerType value = kInvalidValue;
+  while (value == kInvalidValue) {
+    value = static_cast<IntegerType>(engine());
+  }
 
-  return BasicUUID(uniform_distribution(random_engine));
+  return BasicUUID(value);
+}
+
+template <std::unsigned_integral IntegerType>
+void BasicUUID<IntegerType>::GenerateN(std::span<BasicUUID<IntegerType>> uuids) {
+  auto& engine = detail::ThisThreadUUIDEngine();
+
+  for (auto& uuid : uuids) {
+    IntegerType value = kInvalidValue;
+    while (value == kInvalidValue) {
+      value = static_cast<IntegerType>(engine());
+    }
+
+    uuid = BasicUUID(value);
+  }
 }
 
 using UUID = BasicUUID<uint64_t>;
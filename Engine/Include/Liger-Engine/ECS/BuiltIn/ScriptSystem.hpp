@@ -28,25 +28,97 @@
 #pragma once
 
 #include <Liger-Engine/Core/Time.hpp>
+#include <Liger-Engine/ECS/ConstructBatch.hpp>
 #include <Liger-Engine/ECS/DefaultComponents.hpp>
 #include <Liger-Engine/ECS/System.hpp>
 
+#include <limits>
+#include <typeindex>
+#include <unordered_map>
+
 namespace liger::ecs {
 
-class ScriptSystem : public ExclusiveComponentSystem<const ScriptComponent> {
+/**
+ * @brief Updates scripts of @ref ScriptComponent, grouped by their concrete type.
+ *
+ * Each group keeps its entities and scripts in contiguous arrays and is updated with a single
+ * @ref IScript::OnUpdateBatch call, so the same code runs back to back. Groups of thread-safe
+ * scripts are split into batches updated in parallel, after all other scripts have been updated.
+ *
+ * Scripts with an @ref IScript::Run coroutine are not grouped, the coroutines are resumed by a
+ * @ref ScriptScheduler before the groups are updated, and only once what they await is ready.
+ *
+ * Scripts attached during the update are only updated from the next frame on. Replacing the
+ * component's script re-attaches the entity, the replaced script must not be the one being updated.
+ */
+class ScriptSystem : public ISystem {
  public:
+  /**
+   * @brief Min number of thread-safe scripts of a type to update them in parallel.
+   */
+  static constexpr uint32_t kMinParallelBatchSize = 256;
+
   explicit ScriptSystem(const FrameTimer& frame_timer);
   ~ScriptSystem() override = default;
 
   void Setup(entt::registry& registry) override;
-  void Run(entt::registry& registry, entt::entity entity, const ScriptComponent& script) override;
+
+  void SetupExecution(entt::organizer& organizer) override;
+  void PrepareRegistry(entt::registry& registry) override;
+
+  void RunForEach(entt::registry& registry) override;
+  void RunForEachParallel(entt::registry& registry, tf::Subflow& subflow) override;
+
+  uint32_t MinParallelChunkSize() const override { return kMinParallelBatchSize; }
 
   void OnAttach(entt::registry& registry, entt::entity entity);
+  void OnAttachBatch(entt::registry& registry, std::span<const Entity> entities);
+  void OnReplace(entt::registry& registry, entt::entity entity);
+  void OnDetach(entt::registry& registry, entt::entity entity);
 
   std::string_view Name() const override { return "ScriptSystem<const ScriptComponent>"; }
 
  private:
-  const FrameTimer& frame_timer_;
+  static constexpr uint32_t kNotGrouped = std::numeric_limits<uint32_t>::max();
+
+  struct ScriptGroup {
+    std::vector<Entity>   entities;
+    std::vector<IScript*> scripts;
+    bool                  thread_safe{false};
+    bool                  has_detached{false};
+  };
+
+  /* Kept by the system rather than in the component, which a replace would overwrite */
+  struct Attachment {
+    IScript*   script    {nullptr};
+    uint32_t   group     {kNotGrouped};
+    uint32_t   group_idx {kNotGrouped};
+    SlotHandle task      {};
+  };
+
+  /* Only used to declare component access to the organizer, never called */
+  void DeclareAccess(entt::registry&, entt::entity, const ScriptComponent&) {}
+
+  void Attach(entt::registry& registry, entt::entity entity);
+  void Detach(entt::entity entity, std::unique_ptr<IScript> script);
+  void AddToGroup(Attachment& attachment, entt::entity entity);
+  void UpdateBatch(entt::registry& registry, ScriptGroup& group, size_t begin, size_t end, float dt);
+  void FinishUpdate();
+
+  /* Time since the last update, which is longer than a frame if the system is not run every frame */
+  float ElapsedTime();
+
+  const FrameTimer&                             frame_timer_;
+  ScriptScheduler                               scheduler_;
+  ConstructBatchSignals*                        batch_signals_{nullptr};
+
+  std::vector<ScriptGroup>                      groups_;
+  std::unordered_map<std::type_index, uint32_t> group_slots_;
+  std::unordered_map<Entity, Attachment>        attachments_;
+  std::vector<Entity>                           pending_attach_;
+  std::vector<std::unique_ptr<IScript>>         detached_scripts_;
+  bool                                          updating_{false};
+  float                                         last_update_time_{-1.0f};
 };
 
 }  // namespace liger::ecs
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file SpatialIndexSystem.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Containers/DynamicBVH.hpp>
+#include <Liger-Engine/ECS/DefaultComponents.hpp>
+#include <Liger-Engine/ECS/System.hpp>
+
+#include <optional>
+
+namespace liger::ecs {
+
+/**
+ * @brief Keeps a @ref DynamicBVH over the world space bounds of entities with @ref WorldTransform and @ref Bounds.
+ *
+ * Changes are detected by comparing the transform and bounds with the ones the entity was last indexed with, and
+ * only entities leaving their leaf's enlarged box touch the tree. The index reflects the world transforms at the
+ * time the system has run, queries must not run concurrently with the system.
+ */
+class SpatialIndexSystem : public ISystem {
+ public:
+  struct RaycastHit {
+    Entity entity;
+    float  distance;
+  };
+
+  SpatialIndexSystem() = default;
+  explicit SpatialIndexSystem(DynamicBVH::Policy policy);
+  ~SpatialIndexSystem() override = default;
+
+  void Setup(entt::registry& registry) override;
+
+  void SetupExecution(entt::organizer& organizer) override;
+  void PrepareRegistry(entt::registry& registry) override;
+
+  void RunForEach(entt::registry& registry) override;
+
+  std::string_view Name() const override { return "SpatialIndexSystem"; }
+
+  const DynamicBVH& GetTree() const;
+
+  /**
+   * @brief Find entities overlapping the @ref AABB, @ref Sphere or @ref Frustum, callback(entity) may return false to stop.
+   */
+  template <typename Shape, typename Callback>
+  void Query(const Shape& shape, Callback&& callback) const;
+
+  /**
+   * @brief Same as @ref DynamicBVH::Raycast, but the callback takes the entity instead of the user data.
+   */
+  template <typename Callback>
+  void Raycast(const Ray& ray, float max_distance, Callback&& callback) const;
+
+  /**
+   * @brief Closest entity whose bounds are hit by the ray, e.g. for picking.
+   */
+  std::optional<RaycastHit> RaycastClosest(const Ray& ray, float max_distance) const;
+
+  /**
+   * @brief Run the queries in parallel, callback(query_idx, entity) must be thread-safe.
+   */
+  template <typename Shape, typename Callback>
+  void QueryBatch(tf::Executor& executor, std::span<const Shape> shapes, Callback&& callback) const;
+
+ private:
+  /* Only used to declare component access to the organizer, never called */
+  void DeclareAccess(const WorldTransform&, const Bounds&, SpatialProxy&) {}
+
+  void OnIndexedComponentDestroy(entt::registry& registry, entt::entity entity);
+  void OnProxyDestroy(entt::registry& registry, entt::entity entity);
+
+  static AABB WorldBounds(const Transform3D& transform, const AABB& bounds);
+
+  DynamicBVH          tree_;
+  std::vector<Entity> new_entities_;
+};
+
+template <typename Shape, typename Callback>
+void SpatialIndexSystem::Query(const Shape& shape, Callback&& callback) const {
+  tree_.Query(shape, [&callback](uint32_t user_data) { return callback(static_cast<Entity>(user_data)); });
+}
+
+template <typename Callback>
+void SpatialIndexSystem::Raycast(const Ray& ray, float max_distance, Callback&& callback) const {
+  tree_.Raycast(ray, max_distance, [&callback](uint32_t user_data, float distance) {
+    return callback(static_cast<Entity>(user_data), distance);
+  });
+}
+
+template <typename Shape, typename Callback>
+void SpatialIndexSystem::QueryBatch(tf::Executor& executor, std::span<const Shape> shapes, Callback&& callback) const {
+  tree_.QueryBatch(executor, shapes, [&callback](size_t query_idx, uint32_t user_data) {
+    return callback(query_idx, static_cast<Entity>(user_data));
+  });
+}
+
+}  // namespace liger::ecs
@@ -0,0 +1,93 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file TransformHierarchySystem.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/ECS/ConstructBatch.hpp>
+#include <Liger-Engine/ECS/DefaultComponents.hpp>
+#include <Liger-Engine/ECS/System.hpp>
+
+#include <atomic>
+
+namespace liger::ecs {
+
+/**
+ * @brief Computes @ref WorldTransform of entities with @ref LocalTransform and optional @ref Parent.
+ *
+ * Entities are kept sorted by their depth in the hierarchy, the sorting is only redone once the
+ * hierarchy structure changes. Only dirty subtrees are recomputed, each depth level is processed
+ * in parallel on the executor if there are enough entities. @ref HierarchyNode::changed tells
+ * whether the entity's world transform has been recomputed this frame.
+ */
+class TransformHierarchySystem : public ISystem {
+ public:
+  /**
+   * @brief Min number of entities in a depth level to process it in parallel.
+   */
+  static constexpr uint32_t kMinParallelLevelSize = 1024;
+
+  explicit TransformHierarchySystem(tf::Executor& executor);
+  ~TransformHierarchySystem() override = default;
+
+  void Setup(entt::registry& registry) override;
+
+  void SetupExecution(entt::organizer& organizer) override;
+  void PrepareRegistry(entt::registry& registry) override;
+
+  void RunForEach(entt::registry& registry) override;
+
+  std::string_view Name() const override { return "TransformHierarchySystem"; }
+
+ private:
+  /* Only used to declare component access to the organizer, never called */
+  void DeclareAccess(const LocalTransform&, const Parent&, WorldTransform&, HierarchyNode&) {}
+
+  void OnLocalTransformConstruct(entt::registry& registry, entt::entity entity);
+  void OnLocalTransformConstructBatch(entt::registry& registry, std::span<const Entity> entities);
+  void OnLocalTransformUpdate(entt::registry& registry, entt::entity entity);
+  void OnLocalTransformDestroy(entt::registry& registry, entt::entity entity);
+  void OnParentChange(entt::registry& registry, entt::entity entity);
+
+  void RebuildHierarchy(entt::registry& registry);
+  void BuildTaskflow(entt::registry& registry);
+  void ProcessRange(entt::registry& registry, uint32_t begin, uint32_t end);
+
+  tf::Executor&          executor_;
+  tf::Taskflow           taskflow_;
+  bool                   parallel_{false};
+  ConstructBatchSignals* batch_signals_{nullptr};
+
+  std::vector<Entity>    sorted_entities_;
+  std::vector<uint32_t>  level_offsets_;
+  std::vector<Entity>    chain_;
+
+  std::atomic<bool>      structure_dirty_{true};
+  std::atomic<bool>      any_dirty_{true};
+  bool                   changed_last_frame_{false};
+};
+
+}  // namespace liger::ecs
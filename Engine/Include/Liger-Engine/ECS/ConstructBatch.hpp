@@ -0,0 +1,103 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file ConstructBatch.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/Containers/TypeMap.hpp>
+#include <Liger-Engine/ECS/Entity.hpp>
+
+#include <entt/entity/registry.hpp>
+#include <entt/signal/sigh.hpp>
+
+#include <span>
+#include <utility>
+
+namespace liger::ecs {
+
+/**
+ * @brief Signals notified once per bulk construction of a component, with all the entities that got it.
+ *
+ * Components inserted in bulk via @ref Insert (e.g. by @ref Scene::Instantiate and @ref SceneFormat::Load) still
+ * emit the registry's on_construct for each entity. Listeners connected to both should return early from the
+ * per-entity one while @ref InBatch, and do the work for the whole span in the batch one.
+ */
+class ConstructBatchSignals {
+ public:
+  using Signal = entt::sigh<void(entt::registry&, std::span<const Entity>)>;
+
+  /**
+   * @brief Signals of the registry, stored in its context.
+   */
+  static ConstructBatchSignals& Get(entt::registry& registry) {
+    return registry.ctx().emplace<ConstructBatchSignals>();
+  }
+
+  template <typename Component>
+  entt::sink<Signal> OnConstruct() {
+    return entt::sink{slots_.Get<Component>().signal};
+  }
+
+  /**
+   * @brief Whether the component is being inserted in bulk, in which case the batch listeners are notified afterwards.
+   */
+  template <typename Component>
+  bool InBatch() {
+    return slots_.Get<Component>().in_batch;
+  }
+
+  /**
+   * @brief Insert the component to all the entities, args are either a single value or an iterator to the components.
+   */
+  template <typename Component, typename... Args>
+  void Insert(entt::registry& registry, std::span<const Entity> entities, Args&&... args) {
+    auto& slot    = slots_.Get<Component>();
+    auto& storage = registry.storage<Component>();
+    storage.reserve(storage.size() + entities.size());
+
+    if (slot.signal.empty()) {
+      registry.insert<Component>(entities.begin(), entities.end(), std::forward<Args>(args)...);
+      return;
+    }
+
+    slot.in_batch = true;
+    registry.insert<Component>(entities.begin(), entities.end(), std::forward<Args>(args)...);
+    slot.in_batch = false;
+
+    slot.signal.publish(registry, entities);
+  }
+
+ private:
+  template <typename Component>
+  struct Slot {
+    Signal signal;
+    bool   in_batch{false};
+  };
+
+  TypeMap<Slot> slots_;
+};
+
+}  // namespace liger::ecs
@@ -31,6 +31,7 @@
 #include <Liger-Engine/ECS/Scene.hpp>
 #include <Liger-Engine/ECS/Script.hpp>
 
+#include <limits>
 #include <string>
 
 namespace liger::ecs {
@@ -43,6 +44,55 @@ struct NameComponent {
 
 struct WorldTransform : Transform3D {};
 
+/**
+ * @brief Transform relative to the @ref Parent, or to the world if there is no parent.
+ *
+ * Entities with this component get their @ref WorldTransform computed by the
+ * @ref TransformHierarchySystem. Modify it via registry.patch/replace (or call
+ * registry.patch<LocalTransform>(entity) after modifying it in-place), so that
+ * the change is noticed.
+ */
+struct LocalTransform : Transform3D {};
+
+/**
+ * @brief Parent in the transform hierarchy, the parent entity must have a @ref LocalTransform as well.
+ */
+struct Parent {
+  Entity entity{entt::null};
+};
+
+/**
+ * @brief Hierarchy info maintained by the @ref TransformHierarchySystem.
+ */
+struct HierarchyNode {
+  static constexpr uint32_t kInvalidDepth = std::numeric_limits<uint32_t>::max();
+
+  Entity   parent  {entt::null};
+  uint32_t depth   {0};
+  bool     dirty   {true};
+
+  /** @brief Whether the world transform has been recomputed this frame. */
+  bool     changed {false};
+};
+
+/**
+ * @brief Local space bounds, entities with a @ref WorldTransform and bounds are indexed by the @ref SpatialIndexSystem.
+ */
+struct Bounds {
+  AABB box;
+};
+
+/**
+ * @brief Leaf of the entity in the spatial index, maintained by the @ref SpatialIndexSystem.
+ */
+struct SpatialProxy {
+  uint32_t    proxy{std::numeric_limits<uint32_t>::max()};
+
+  /** @brief Transform and bounds the entity was last indexed with. */
+  Transform3D transform;
+  AABB        bounds;
+};
+
 struct Camera {
   float fov          {60.0f};
   float near         {0.1f};
@@ -55,6 +105,9 @@ struct Camera {
   }
 };
 
+/**
+ * @brief Script attached to the entity, scripts of the same concrete type are updated together by the @ref ScriptSystem.
+ */
 struct ScriptComponent {
   ScriptComponent() = default;
   ScriptComponent(std::unique_ptr<IScript> script) : script(std::move(script)) {}
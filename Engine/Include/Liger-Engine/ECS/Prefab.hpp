@@ -0,0 +1,166 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file Prefab.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Core/TypeSlot.hpp>
+#include <Liger-Engine/ECS/ConstructBatch.hpp>
+#include <Liger-Engine/ECS/DefaultComponents.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace liger::ecs {
+
+/**
+ * @brief Component of a @ref Prefab, added to all of its instances at once.
+ */
+class IComponentTemplate {
+ public:
+  virtual ~IComponentTemplate() = default;
+
+  virtual void Instantiate(entt::registry& registry, ConstructBatchSignals& signals,
+                           std::span<const Entity> entities) const = 0;
+};
+
+template <typename Component>
+class ComponentTemplate final : public IComponentTemplate {
+ public:
+  explicit ComponentTemplate(Component value) : value_(std::move(value)) {}
+  ~ComponentTemplate() override = default;
+
+  void Instantiate(entt::registry& registry, ConstructBatchSignals& signals,
+                   std::span<const Entity> entities) const override {
+    signals.Insert<Component>(registry, entities, value_);
+  }
+
+ private:
+  Component value_;
+};
+
+template <typename Component, typename Factory>
+class FactoryComponentTemplate final : public IComponentTemplate {
+ public:
+  explicit FactoryComponentTemplate(Factory factory) : factory_(std::move(factory)) {}
+  ~FactoryComponentTemplate() override = default;
+
+  void Instantiate(entt::registry& registry, ConstructBatchSignals& signals,
+                   std::span<const Entity> entities) const override {
+    std::vector<Component> components;
+    components.reserve(entities.size());
+
+    for (size_t idx = 0U; idx < entities.size(); ++idx) {
+      components.emplace_back(factory_());
+    }
+
+    signals.Insert<Component>(registry, entities, std::make_move_iterator(components.begin()));
+  }
+
+ private:
+  Factory factory_;
+};
+
+/**
+ * @brief Set of components added to each instance by @ref Scene::Instantiate.
+ *
+ * Instances are placed by the transforms passed to @ref Scene::Instantiate, which are set as their
+ * @ref WorldTransform, and as their @ref LocalTransform as well if the prefab has one. The values of transform
+ * components added to the prefab are ignored. Other components are added after the transforms, in the order
+ * they have been added to the prefab.
+ *
+ * Prefabs are also assets, loaded from single-entity scene files by the @ref asset::loaders::PrefabLoader.
+ */
+class Prefab {
+ public:
+  /**
+   * @brief Add the component copied to each instance, replacing the previously added one of the same type.
+   */
+  template <typename Component>
+  void Add(Component component);
+
+  /**
+   * @brief Add the component created by the factory for each instance, for components which cannot be copied
+   *        (e.g. @ref ScriptComponent).
+   */
+  template <typename Component, std::invocable Factory>
+  void AddFactory(Factory factory);
+
+  template <typename Component>
+  bool Has() const;
+
+  /**
+   * @brief Add the components to the created entities, one per transform.
+   */
+  void Instantiate(entt::registry& registry, std::span<const Entity> entities,
+                   std::span<const Transform3D> transforms) const;
+
+ private:
+  struct Entry {
+    TypeSlotId                          type;
+    std::unique_ptr<IComponentTemplate> component;
+  };
+
+  void AddTemplate(TypeSlotId type, std::unique_ptr<IComponentTemplate> component);
+
+  std::vector<Entry> components_;
+  bool               local_transform_{false};
+};
+
+template <typename Component>
+void Prefab::Add(Component component) {
+  if constexpr (std::same_as<Component, LocalTransform>) {
+    local_transform_ = true;
+  } else if constexpr (!std::same_as<Component, WorldTransform>) {
+    AddTemplate(TypeSlot<Prefab, Component>::Value(), std::make_unique<ComponentTemplate<Component>>(std::move(component)));
+  }
+}
+
+template <typename Component, std::invocable Factory>
+void Prefab::AddFactory(Factory factory) {
+  static_assert(std::convertible_to<std::invoke_result_t<Factory>, Component>);
+  AddTemplate(TypeSlot<Prefab, Component>::Value(),
+              std::make_unique<FactoryComponentTemplate<Component, Factory>>(std::move(factory)));
+}
+
+template <typename Component>
+bool Prefab::Has() const {
+  if constexpr (std::same_as<Component, WorldTransform>) {
+    return true;
+  } else if constexpr (std::same_as<Component, LocalTransform>) {
+    return local_transform_;
+  } else {
+    const auto type = TypeSlot<Prefab, Component>::Value();
+    return std::any_of(components_.begin(), components_.end(), [type](const auto& entry) { return entry.type == type; });
+  }
+}
+
+}  // namespace liger::ecs
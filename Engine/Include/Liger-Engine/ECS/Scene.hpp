@@ -27,18 +27,39 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/Math/Transform3D.hpp>
 #include <Liger-Engine/ECS/Entity.hpp>
 
 #include <entt/entity/organizer.hpp>
 #include <entt/entity/registry.hpp>
 #include <taskflow/taskflow.hpp>
 
+#include <span>
+#include <vector>
+
 namespace liger::ecs {
 
+class Prefab;
+
 class Scene {
  public:
   Entity CreateEntity(std::string_view name = "");
 
+  /**
+   * @brief Create an instance of the prefab for each transform.
+   *
+   * Entities are created at once and each component is added to all of them in bulk, listeners of
+   * @ref ConstructBatchSignals are notified once per component type.
+   *
+   * @return Entities of the instances, in the order of the transforms.
+   */
+  std::vector<Entity> Instantiate(const Prefab& prefab, std::span<const Transform3D> transforms);
+
+  /**
+   * @brief Same as the other overload, but writes the entities to the span, which must be as large as transforms.
+   */
+  void Instantiate(const Prefab& prefab, std::span<const Transform3D> transforms, std::span<Entity> entities);
+
   entt::registry& GetRegistry();
 
  private:
@@ -0,0 +1,431 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file SceneFormat.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Asset/Manager.hpp>
+#include <Liger-Engine/Core/Containers/TypeMap.hpp>
+#include <Liger-Engine/Core/Platform/MappedFile.hpp>
+#include <Liger-Engine/ECS/DefaultComponents.hpp>
+#include <Liger-Engine/ECS/LogChannel.hpp>
+#include <Liger-Engine/ECS/Prefab.hpp>
+
+#include <concepts>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace liger::ecs {
+
+/**
+ * @brief Id of a component or asset type in scene files.
+ */
+using SceneTypeId = uint64_t;
+
+/**
+ * @brief FNV-1a hash of the name the type is registered under in the @ref SceneFormat.
+ */
+constexpr SceneTypeId HashSceneTypeName(std::string_view name) {
+  SceneTypeId hash = 0xCBF29CE484222325ULL;
+  for (char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001B3ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Asset referenced by a scene, the whole table is requested before any of the scene's entities is created.
+ */
+struct SceneAssetRef {
+  asset::Id   id;
+  SceneTypeId type;
+};
+
+class SceneFormat;
+
+/**
+ * @brief State shared by the component columns while saving a scene.
+ */
+class SceneWriteContext {
+ public:
+  static constexpr uint32_t kNullEntity = std::numeric_limits<uint32_t>::max();
+
+  SceneWriteContext(const SceneFormat& format, const std::unordered_map<Entity, uint32_t>& entity_indices);
+
+  /**
+   * @brief Index of the entity in the file, kNullEntity if it is null or not saved.
+   */
+  uint32_t EntityIndex(Entity entity) const;
+
+  /**
+   * @brief Add the asset to the scene's asset table.
+   * @return Id to store in the component column.
+   */
+  template <typename Asset>
+  asset::Id ReferenceAsset(const asset::Handle<Asset>& handle);
+
+  std::span<const SceneAssetRef> Assets() const;
+
+ private:
+  void ReferenceAsset(asset::Id id, SceneTypeId type);
+
+  const SceneFormat&                           format_;
+  const std::unordered_map<Entity, uint32_t>& entity_indices_;
+  std::vector<SceneAssetRef>                   assets_;
+  std::unordered_set<asset::Id>                referenced_assets_;
+};
+
+/**
+ * @brief State shared by the component columns while loading a scene.
+ */
+class SceneReadContext {
+ public:
+  explicit SceneReadContext(asset::Manager* asset_manager);
+
+  /**
+   * @brief Entity created for the index in the file, null if the index is kNullEntity.
+   */
+  Entity GetEntity(uint32_t index) const;
+
+  /**
+   * @brief Get the asset, each asset is requested from the manager only once per load.
+   */
+  template <typename Asset>
+  asset::Handle<Asset> GetAsset(asset::Id id);
+
+ private:
+  template <typename Asset>
+  using AssetCache = std::unordered_map<asset::Id, asset::Handle<Asset>>;
+
+  asset::Manager*         asset_manager_;
+  std::span<const Entity> entities_;
+  TypeMap<AssetCache>     assets_;
+
+  friend class SceneFormat;
+};
+
+/**
+ * @brief How a component is stored in scene files.
+ *
+ * By default components are stored bitwise, which requires them to be trivially copyable and to reference
+ * neither entities nor assets. Otherwise specialize the traits with a trivially copyable Stored type and
+ * the conversions:
+ *
+ *   static Stored    Save(const Component& component, SceneWriteContext& context);
+ *   static Component Load(const Stored& stored, SceneReadContext& context);
+ */
+template <typename Component>
+struct SceneComponentTraits {
+  using Stored = Component;
+};
+
+template <typename Component>
+concept ConvertedSceneComponent = requires(const Component& component, SceneWriteContext& write_context,
+                                           const typename SceneComponentTraits<Component>::Stored& stored,
+                                           SceneReadContext& read_context) {
+  { SceneComponentTraits<Component>::Save(component, write_context) };
+  { SceneComponentTraits<Component>::Load(stored, read_context) } -> std::convertible_to<Component>;
+};
+
+template <>
+struct SceneComponentTraits<Parent> {
+  using Stored = uint32_t;
+
+  static Stored Save(const Parent& parent, SceneWriteContext& context) { return context.EntityIndex(parent.entity); }
+  static Parent Load(Stored index, SceneReadContext& context) { return Parent{context.GetEntity(index)}; }
+};
+
+/**
+ * @brief Component column of scene files, stored as a contiguous array of entity indices and one of components.
+ */
+class ISceneColumn {
+ public:
+  virtual ~ISceneColumn() = default;
+
+  virtual uint32_t StoredSize() const = 0;
+
+  virtual void CollectEntities(entt::registry& registry, std::vector<Entity>& entities) const = 0;
+
+  virtual void Save(entt::registry& registry, std::span<const Entity> entities, SceneWriteContext& context,
+                    std::byte* dst) const = 0;
+
+  /**
+   * @brief Construct the components of all entities at once.
+   */
+  virtual void Load(entt::registry& registry, std::span<const Entity> entities, const std::byte* src,
+                    SceneReadContext& context) const = 0;
+
+  /**
+   * @brief Add the stored component to the prefab.
+   */
+  virtual void LoadTemplate(Prefab& prefab, const std::byte* src, SceneReadContext& context) const = 0;
+};
+
+template <typename Component>
+class SceneColumn final : public ISceneColumn {
+ public:
+  using Traits = SceneComponentTraits<Component>;
+  using Stored = typename Traits::Stored;
+
+  static_assert(std::is_trivially_copyable_v<Stored>, "Components must be stored as trivially copyable types");
+
+  ~SceneColumn() override = default;
+
+  uint32_t StoredSize() const override { return sizeof(Stored); }
+
+  void CollectEntities(entt::registry& registry, std::vector<Entity>& entities) const override {
+    auto view = registry.view<Component>();
+    entities.assign(view.begin(), view.end());
+  }
+
+  void Save(entt::registry& registry, std::span<const Entity> entities, SceneWriteContext& context,
+            std::byte* dst) const override {
+    auto& storage = registry.storage<Component>();
+
+    for (auto entity : entities) {
+      const auto& component = storage.get(entity);
+
+      if constexpr (ConvertedSceneComponent<Component>) {
+        const Stored stored = Traits::Save(component, context);
+        std::memcpy(dst, &stored, sizeof(Stored));
+      } else {
+        std::memcpy(dst, &component, sizeof(Stored));
+      }
+
+      dst += sizeof(Stored);
+    }
+  }
+
+  void Load(entt::registry& registry, std::span<const Entity> entities, const std::byte* src,
+            SceneReadContext& context) const override {
+    const auto* stored  = reinterpret_cast<const Stored*>(src);
+    auto&       signals = ConstructBatchSignals::Get(registry);
+
+    if constexpr (ConvertedSceneComponent<Component>) {
+      std::vector<Component> components;
+      components.reserve(entities.size());
+
+      for (size_t idx = 0U; idx < entities.size(); ++idx) {
+        components.emplace_back(Traits::Load(stored[idx], context));
+      }
+
+      signals.Insert<Component>(registry, entities, std::make_move_iterator(components.begin()));
+    } else {
+      signals.Insert<Component>(registry, entities, stored);
+    }
+  }
+
+  void LoadTemplate(Prefab& prefab, const std::byte* src, SceneReadContext& context) const override {
+    if constexpr (ConvertedSceneComponent<Component>) {
+      prefab.Add<Component>(Traits::Load(*reinterpret_cast<const Stored*>(src), context));
+    } else {
+      Component component;
+      std::memcpy(&component, src, sizeof(Stored));
+      prefab.Add<Component>(std::move(component));
+    }
+  }
+};
+
+/**
+ * @brief Memory-mapped scene file, components are constructed directly from the mapping.
+ */
+class SceneFile {
+ public:
+  /**
+   * @brief Map and validate the file.
+   * @return Whether the file is a valid scene file.
+   */
+  bool Open(const std::filesystem::path& filepath);
+
+  uint32_t EntityCount() const;
+
+  std::span<const SceneAssetRef> Assets() const;
+
+ private:
+  struct Column {
+    SceneTypeId      type;
+    uint32_t         stored_size;
+    const uint32_t*  entities;
+    const std::byte* data;
+    uint32_t         count;
+  };
+
+  MappedFile                     file_;
+  uint32_t                       entity_count_{0U};
+  std::vector<Column>            columns_;
+  std::span<const SceneAssetRef> assets_;
+
+  friend class SceneFormat;
+};
+
+/**
+ * @brief Set of component and asset types stored in scene files (.lscene).
+ *
+ * A file stores each registered component as a column: the strictly increasing indices of the entities
+ * having the component and the array of their components, so that loading constructs each component
+ * type in bulk. Assets are
+ * referenced by @ref asset::Id and listed in the file's asset table. Files use the native byte order.
+ */
+class SceneFormat {
+ public:
+  static constexpr uint32_t kBlobAlignment = 16U;
+
+  /**
+   * @brief Register the component, the name identifies its column in files.
+   *
+   * Columns are loaded in registration order, so components constructed by listeners of other components
+   * (e.g. @ref WorldTransform by the @ref TransformHierarchySystem) must be registered before those.
+   */
+  template <typename Component>
+  void RegisterComponent(std::string_view name);
+
+  /**
+   * @brief Register the asset type, needed to save and load components referencing such assets.
+   */
+  template <typename Asset>
+  void RegisterAsset(std::string_view name);
+
+  /**
+   * @brief Register @ref WorldTransform, @ref LocalTransform, @ref Parent and @ref Camera.
+   */
+  void RegisterDefaultComponents();
+
+  /**
+   * @brief Save the entities having any of the registered components.
+   * @return Whether successfully saved.
+   */
+  bool Save(Scene& scene, const std::filesystem::path& filepath) const;
+
+  /**
+   * @brief Create the file's entities in the scene.
+   *
+   * All of the referenced assets are requested from the manager in one batch before any entity is created.
+   *
+   * @return Whether successfully loaded, in which case the entities are created in the file's order.
+   */
+  bool Load(const SceneFile& file, Scene& scene, asset::Manager& asset_manager) const;
+
+  /**
+   * @brief Same as the other overload, but for files without asset references.
+   */
+  bool Load(const SceneFile& file, Scene& scene) const;
+
+  /**
+   * @brief Fill the prefab with the components of the file's first entity, references to other entities are null.
+   * @return Whether successfully loaded.
+   */
+  bool LoadPrefab(const SceneFile& file, Prefab& prefab, asset::Manager& asset_manager) const;
+
+ private:
+  struct ColumnType {
+    SceneTypeId                   id;
+    std::string                   name;
+    std::unique_ptr<ISceneColumn> column;
+  };
+
+  struct AssetType {
+    SceneTypeId id;
+    std::string name;
+    void        (*request)(SceneReadContext& context, asset::Id id);
+  };
+
+  static constexpr SceneTypeId kUnregisteredAsset = 0U;
+
+  template <typename Asset>
+  SceneTypeId GetAssetType() const;
+
+  void AddColumn(std::string_view name, std::unique_ptr<ISceneColumn> column);
+  void AddAssetType(std::string_view name, TypeSlotId slot, void (*request)(SceneReadContext&, asset::Id));
+
+  bool MatchColumns(const SceneFile& file, std::vector<const SceneFile::Column*>& file_columns) const;
+  void RequestAssets(const SceneFile& file, SceneReadContext& context) const;
+
+  bool Load(const SceneFile& file, Scene& scene, asset::Manager* asset_manager) const;
+
+  std::vector<ColumnType>  columns_;
+  std::vector<AssetType>   asset_types_;
+  std::vector<SceneTypeId> asset_type_by_slot_;
+
+  friend class SceneWriteContext;
+};
+
+template <typename Asset>
+asset::Id SceneWriteContext::ReferenceAsset(const asset::Handle<Asset>& handle) {
+  const auto id = handle.GetId();
+  if (id.Valid()) {
+    ReferenceAsset(id, format_.GetAssetType<Asset>());
+  }
+
+  return id;
+}
+
+template <typename Asset>
+asset::Handle<Asset> SceneReadContext::GetAsset(asset::Id id) {
+  if (!id.Valid() || asset_manager_ == nullptr) {
+    return {};
+  }
+
+  auto& cache = assets_.Get<Asset>();
+
+  auto it = cache.find(id);
+  if (it == cache.end()) {
+    it = cache.emplace(id, asset_manager_->GetAsset<Asset>(id)).first;
+  }
+
+  return it->second;
+}
+
+template <typename Component>
+void SceneFormat::RegisterComponent(std::string_view name) {
+  static_assert(alignof(typename SceneColumn<Component>::Stored) <= kBlobAlignment);
+  AddColumn(name, std::make_unique<SceneColumn<Component>>());
+}
+
+template <typename Asset>
+void SceneFormat::RegisterAsset(std::string_view name) {
+  AddAssetType(name, TypeSlot<SceneFormat, Asset>::Value(), [](SceneReadContext& context, asset::Id id) {
+    [[maybe_unused]] auto handle = context.GetAsset<Asset>(id);
+  });
+}
+
+template <typename Asset>
+SceneTypeId SceneFormat::GetAssetType() const {
+  const auto slot = TypeSlot<SceneFormat, Asset>::Value();
+  LIGER_ASSERT(slot < asset_type_by_slot_.size() && asset_type_by_slot_[slot] != kUnregisteredAsset, kLogChannelECS,
+               "Asset type is not registered in the scene format");
+
+  return asset_type_by_slot_[slot];
+}
+
+}  // namespace liger::ecs
@@ -29,6 +29,9 @@
 
 #include <Liger-Engine/Core/Event/EventDispatcher.hpp>
 #include <Liger-Engine/ECS/Scene.hpp>
+#include <Liger-Engine/ECS/ScriptScheduler.hpp>
+
+#include <span>
 
 namespace liger::ecs {
 
@@ -38,6 +41,52 @@ class IScript {
 
   virtual void OnAttach(Entity entity)                                     = 0;
   virtual void OnUpdate(entt::registry& registry, Entity entity, float dt) = 0;
+
+  /**
+   * @brief Update a batch of scripts of this script's dynamic type, called on the first attached script of the batch.
+   *
+   * Override to process the batch without a virtual call per entity. A batch may be only a part of the
+   * scripts of the type, and thread-safe scripts' batches may be updated in parallel, see @ref ThreadSafe.
+   * Entities whose script is detached during the update are set to entt::null and must be skipped, along
+   * with their script.
+   */
+  virtual void OnUpdateBatch(entt::registry& registry, std::span<IScript* const> scripts,
+                             std::span<const Entity> entities, float dt) {
+    for (size_t i = 0U; i < entities.size(); ++i) {
+      if (entities[i] != entt::null) {
+        scripts[i]->OnUpdate(registry, entities[i], dt);
+      }
+    }
+  }
+
+  /**
+   * @brief Whether scripts of this type can be updated in parallel batches.
+   *
+   * Such scripts must only access components of their own entity, and must not create or destroy
+   * entities or components.
+   */
+  virtual bool ThreadSafe() const { return false; }
+
+  /**
+   * @brief Coroutine started once the script is attached, an empty task if the script has none.
+   *
+   * Scripts with a coroutine are not updated via @ref OnUpdate, the coroutine is only resumed once
+   * what it awaits is ready, see @ref ScriptScheduler.
+   */
+  virtual ScriptTask Run(entt::registry& registry, Entity entity) { return {}; }
+};
+
+/**
+ * @brief Script driven only by its @ref Run coroutine, which costs nothing per frame while waiting.
+ */
+class CoroutineScript : public IScript {
+ public:
+  ~CoroutineScript() override = default;
+
+  void OnAttach(Entity entity) override {}
+  void OnUpdate(entt::registry& registry, Entity entity, float dt) final {}
+
+  ScriptTask Run(entt::registry& registry, Entity entity) override = 0;
 };
 
 }  // namespace liger::ecs
\ No newline at end of file
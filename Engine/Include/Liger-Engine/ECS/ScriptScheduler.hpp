@@ -0,0 +1,317 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file ScriptScheduler.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <Liger-Engine/Asset/Storage.hpp>
+#include <Liger-Engine/Core/Containers/SlotMap.hpp>
+#include <Liger-Engine/Core/Event/EventSink.hpp>
+
+#include <algorithm>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <vector>
+
+namespace liger::ecs {
+
+class ScriptScheduler;
+
+/**
+ * @brief Coroutine of a script, resumed by the @ref ScriptScheduler only once what it awaits is ready.
+ *
+ * The coroutine starts suspended and is first resumed on the scheduler's next tick. It can await
+ * @ref NextFrame, @ref Delay, @ref AssetLoaded and @ref NextEvent.
+ */
+class ScriptTask {
+ public:
+  struct promise_type {
+    ScriptTask get_return_object() { return ScriptTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    void return_void() {}
+    void unhandled_exception();
+
+    ScriptScheduler* scheduler{nullptr};
+    SlotHandle       self;
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  ScriptTask() = default;
+  ~ScriptTask();
+
+  ScriptTask(const ScriptTask& other)            = delete;
+  ScriptTask& operator=(const ScriptTask& other) = delete;
+
+  ScriptTask(ScriptTask&& other) noexcept;
+  ScriptTask& operator=(ScriptTask&& other) noexcept;
+
+  explicit operator bool() const { return bool(handle_); }
+
+ private:
+  explicit ScriptTask(Handle handle) : handle_(handle) {}
+
+  Handle handle_;
+
+  friend class ScriptScheduler;
+};
+
+/**
+ * @brief Resumes script coroutines whose awaited frame, time, asset or event is ready.
+ *
+ * Suspended coroutines are kept in per-awaitable wait lists, so waiting ones cost nothing per tick
+ * except for @ref AssetLoaded, whose asset state is checked once per tick.
+ *
+ * Event sinks are only connected to while a coroutine awaits them, and are disconnected on the
+ * first tick with no coroutine waiting, so an awaited sink only has to outlive the wait.
+ *
+ * @warning Not thread-safe, except for events, which may be dispatched from any thread.
+ */
+class ScriptScheduler {
+ public:
+  ScriptScheduler() = default;
+  ~ScriptScheduler() = default;
+
+  ScriptScheduler(const ScriptScheduler& other)            = delete;
+  ScriptScheduler& operator=(const ScriptScheduler& other) = delete;
+
+  /**
+   * @brief Take ownership of the coroutine, which is first resumed on the next @ref Tick.
+   */
+  SlotHandle Start(ScriptTask task);
+
+  /**
+   * @brief Destroy the coroutine, can be called from the coroutine itself.
+   */
+  void Cancel(SlotHandle task);
+
+  /**
+   * @brief Resume all coroutines which are ready.
+   *
+   * @param time Current time in seconds, e.g. @ref FrameTimer::AbsoluteTime.
+   */
+  void Tick(float time);
+
+  uint32_t TaskCount() const { return tasks_.Size(); }
+
+  /* Used by the awaitables */
+  void WaitNextFrame(SlotHandle task);
+  void WaitFor(SlotHandle task, float seconds);
+  void WaitUntil(SlotHandle task, bool (*ready)(const void*), const void* context);
+
+  template <typename EventT>
+  void WaitForEvent(EventSink<EventT>& sink, SlotHandle task, std::optional<EventT>* event);
+
+ private:
+  struct Timer {
+    float      time;
+    SlotHandle task;
+
+    bool operator>(const Timer& other) const { return time > other.time; }
+  };
+
+  struct Condition {
+    SlotHandle  task;
+    bool        (*ready)(const void*);
+    const void* context;
+  };
+
+  class IEventWaitList {
+   public:
+    virtual ~IEventWaitList() = default;
+
+    virtual const void* Sink() const = 0;
+    virtual bool Empty() const = 0;
+    virtual void Cancel(SlotHandle task) = 0;
+  };
+
+  template <typename EventT>
+  class EventWaitList;
+
+  using TimerQueue = std::priority_queue<Timer, std::vector<Timer>, std::greater<>>;
+
+  void Resume(SlotHandle task);
+  void DisconnectIdleEvents();
+
+  SlotMap<ScriptTask>                          tasks_;
+  float                                        time_{0.0f};
+  SlotHandle                                   running_;
+  bool                                         cancel_running_{false};
+
+  std::vector<SlotHandle>                      next_frame_;
+  std::vector<SlotHandle>                      resuming_;
+  TimerQueue                                   timers_;
+  std::vector<Condition>                       conditions_;
+
+  /* Guards the waiters and the ready events, the lists themselves are only changed by the scheduler's thread */
+  std::mutex                                   event_mutex_;
+  std::vector<std::unique_ptr<IEventWaitList>> event_lists_;
+  std::vector<std::unique_ptr<IEventWaitList>> idle_event_lists_;
+  std::vector<SlotHandle>                      events_ready_;
+};
+
+template <typename EventT>
+class ScriptScheduler::EventWaitList final : public IEventWaitList {
+ public:
+  EventWaitList(ScriptScheduler& scheduler, EventSink<EventT>& sink) : scheduler_(scheduler), sink_(sink) {
+    sink_.template Connect<&EventWaitList::OnEvent>(*this);
+  }
+
+  ~EventWaitList() override { sink_.template Remove<&EventWaitList::OnEvent>(*this); }
+
+  const void* Sink() const override { return &sink_; }
+  bool Empty() const override { return waiters_.empty(); }
+
+  void Cancel(SlotHandle task) override {
+    std::erase_if(waiters_, [task](const Waiter& waiter) { return waiter.task == task; });
+  }
+
+  void Add(SlotHandle task, std::optional<EventT>* event) { waiters_.emplace_back(Waiter{task, event}); }
+
+ private:
+  struct Waiter {
+    SlotHandle             task;
+    std::optional<EventT>* event;
+  };
+
+  /* Events are not consumed, so that other callbacks of the sink still receive them */
+  bool OnEvent(const EventT& event) {
+    std::lock_guard lock(scheduler_.event_mutex_);
+
+    for (auto& waiter : waiters_) {
+      *waiter.event = event;
+      scheduler_.events_ready_.push_back(waiter.task);
+    }
+    waiters_.clear();
+
+    return false;
+  }
+
+  ScriptScheduler&    scheduler_;
+  EventSink<EventT>&  sink_;
+  std::vector<Waiter> waiters_;
+};
+
+template <typename EventT>
+void ScriptScheduler::WaitForEvent(EventSink<EventT>& sink, SlotHandle task, std::optional<EventT>* event) {
+  auto it = std::find_if(event_lists_.begin(), event_lists_.end(),
+                         [&sink](const auto& list) { return list->Sink() == &sink; });
+
+  /* Connected without holding the event mutex, which the sink's dispatching thread takes in OnEvent */
+  if (it == event_lists_.end()) {
+    event_lists_.emplace_back(std::make_unique<EventWaitList<EventT>>(*this, sink));
+    it = std::prev(event_lists_.end());
+  }
+
+  std::lock_guard lock(event_mutex_);
+  static_cast<EventWaitList<EventT>*>(it->get())->Add(task, event);
+}
+
+/**
+ * @brief Resume the coroutine on the next tick.
+ */
+class NextFrame {
+ public:
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(ScriptTask::Handle handle) const {
+    handle.promise().scheduler->WaitNextFrame(handle.promise().self);
+  }
+  void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Resume the coroutine on the first tick after the delay has passed.
+ */
+class Delay {
+ public:
+  explicit Delay(float seconds) : seconds_(seconds) {}
+
+  bool await_ready() const noexcept { return seconds_ <= 0.0f; }
+  void await_suspend(ScriptTask::Handle handle) const {
+    handle.promise().scheduler->WaitFor(handle.promise().self, seconds_);
+  }
+  void await_resume() const noexcept {}
+
+ private:
+  float seconds_;
+};
+
+/**
+ * @brief Resume the coroutine once the asset has either been loaded or failed to load.
+ *
+ * @return Final state of the asset.
+ */
+template <typename Asset>
+class AssetLoaded {
+ public:
+  explicit AssetLoaded(asset::Handle<Asset> asset) : asset_(std::move(asset)) {}
+
+  bool await_ready() const { return Ready(this); }
+  void await_suspend(ScriptTask::Handle handle) const {
+    handle.promise().scheduler->WaitUntil(handle.promise().self, &AssetLoaded::Ready, this);
+  }
+  asset::State await_resume() const { return asset_.GetState(); }
+
+ private:
+  static bool Ready(const void* awaiter) {
+    const auto state = static_cast<const AssetLoaded*>(awaiter)->asset_.GetState();
+    return state == asset::State::Loaded || state == asset::State::Invalid;
+  }
+
+  asset::Handle<Asset> asset_;
+};
+
+/**
+ * @brief Resume the coroutine on the first tick after the next event has been dispatched to the sink.
+ *
+ * The sink must outlive the wait, e.g. the coroutine must be cancelled before the sink's dispatcher is destroyed.
+ *
+ * @return The received event.
+ */
+template <typename EventT>
+class NextEvent {
+ public:
+  explicit NextEvent(EventSink<EventT>& sink) : sink_(sink) {}
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(ScriptTask::Handle handle) {
+    handle.promise().scheduler->WaitForEvent(sink_, handle.promise().self, &event_);
+  }
+  EventT await_resume() { return std::move(*event_); }
+
+ private:
+  EventSink<EventT>&    sink_;
+  std::optional<EventT> event_;
+};
+
+}  // namespace liger::ecs
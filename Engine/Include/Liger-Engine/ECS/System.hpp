@@ -29,6 +29,8 @@
 
 #include <Liger-Engine/ECS/Scene.hpp>
 
+#include <algorithm>
+
 namespace liger::ecs {
 
 class ISystem {
@@ -42,9 +44,67 @@ class ISystem {
 
   virtual void RunForEach(entt::registry& registry) = 0;
 
+  /**
+   * @brief Same as @ref RunForEach, but splits the entities into chunks processed by the subflow's tasks.
+   *
+   * Only called if @ref MinParallelChunkSize is non-zero.
+   */
+  virtual void RunForEachParallel(entt::registry& registry, tf::Subflow& subflow) { RunForEach(registry); }
+
+  /**
+   * @brief Min number of entities processed by a single task, 0 if the system is run on one task.
+   */
+  virtual uint32_t MinParallelChunkSize() const { return 0U; }
+
   virtual std::string_view Name() const = 0;
 };
 
+namespace detail {
+
+/**
+ * @brief Size of the chunks to split count elements into, at least min_chunk_size.
+ *
+ * The number of chunks is limited to a few per worker of the executor running them, so large views are not split
+ * into thousands of tasks.
+ */
+inline size_t ParallelChunkSize(size_t count, uint32_t min_chunk_size, size_t worker_count) {
+  constexpr size_t kChunksPerWorker = 4U;
+
+  const size_t max_chunks = std::max<size_t>(1U, worker_count) * kChunksPerWorker;
+  return std::max<size_t>(std::max(min_chunk_size, 1U), (count + max_chunks - 1U) / max_chunks);
+}
+
+/**
+ * @brief Runs the function for the entities in chunks of at least min_chunk_size, joining the subflow afterwards.
+ */
+template <typename Func>
+void ParallelForEachEntity(const std::vector<entt::entity>& entities, uint32_t min_chunk_size, tf::Subflow& subflow,
+                           Func&& func) {
+  const size_t count       = entities.size();
+  const size_t chunk_size  = ParallelChunkSize(count, min_chunk_size, subflow.executor().num_workers());
+  const size_t chunk_count = (count + chunk_size - 1U) / chunk_size;
+
+  if (chunk_count <= 1U) {
+    for (auto entity : entities) {
+      func(entity);
+    }
+    return;
+  }
+
+  subflow.for_each_index(size_t{0U}, chunk_count, size_t{1U}, [&entities, &func, count, chunk_size](size_t chunk) {
+    const size_t end = std::min(count, (chunk + 1U) * chunk_size);
+    for (size_t i = chunk * chunk_size; i < end; ++i) {
+      func(entities[i]);
+    }
+  });
+
+  subflow.join();
+}
+
+}  // namespace detail
+
+constexpr uint32_t kDefaultMinParallelChunkSize = 1024U;
+
 template <typename... Components>
 requires (!std::is_empty_v<Components> && ...)
 class ComponentSystem : public ISystem {
@@ -67,6 +127,29 @@ class ComponentSystem : public ISystem {
       Run(components...);
     });
   }
+
+  void RunForEachParallel(entt::registry& registry, tf::Subflow& subflow) final {
+    auto view = registry.view<Components...>();
+    entities_.assign(view.begin(), view.end());
+
+    detail::ParallelForEachEntity(entities_, min_parallel_chunk_size_, subflow, [this, &view](entt::entity entity) {
+      Run(view.template get<Components>(entity)...);
+    });
+  }
+
+  uint32_t MinParallelChunkSize() const final { return min_parallel_chunk_size_; }
+
+ protected:
+  /**
+   * @brief Process the entities on multiple tasks, Run must be safe to call concurrently for different entities.
+   */
+  void EnableParallelIteration(uint32_t min_chunk_size = kDefaultMinParallelChunkSize) {
+    min_parallel_chunk_size_ = std::max(min_chunk_size, 1U);
+  }
+
+ private:
+  std::vector<entt::entity> entities_;
+  uint32_t                  min_parallel_chunk_size_{0U};
 };
 
 template <typename... Components>
@@ -91,6 +174,31 @@ class ExclusiveComponentSystem : public ISystem {
       Run(registry, entity, components...);
     });
   }
+
+  void RunForEachParallel(entt::registry& registry, tf::Subflow& subflow) final {
+    auto view = registry.view<Components...>();
+    entities_.assign(view.begin(), view.end());
+
+    detail::ParallelForEachEntity(entities_, min_parallel_chunk_size_, subflow,
+                                  [this, &registry, &view](entt::entity entity) {
+                                    Run(registry, entity, view.template get<Components>(entity)...);
+                                  });
+  }
+
+  uint32_t MinParallelChunkSize() const final { return min_parallel_chunk_size_; }
+
+ protected:
+  /**
+   * @brief Process the entities on multiple tasks, Run must be safe to call concurrently for different entities
+   *        and must not create or destroy entities or components.
+   */
+  void EnableParallelIteration(uint32_t min_chunk_size = kDefaultMinParallelChunkSize) {
+    min_parallel_chunk_size_ = std::max(min_chunk_size, 1U);
+  }
+
+ private:
+  std::vector<entt::entity> entities_;
+  uint32_t                  min_parallel_chunk_size_{0U};
 };
 
 }  // namespace liger::ecs
\ No newline at end of file
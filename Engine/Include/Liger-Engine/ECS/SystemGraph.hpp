@@ -29,26 +29,98 @@
 
 #include <Liger-Engine/ECS/System.hpp>
 
+#include <atomic>
+#include <deque>
+#include <span>
 #include <unordered_set>
 
 namespace liger::ecs {
 
+/**
+ * @brief Builds the taskflow running the systems each frame, ordered by their component access.
+ *
+ * Each system can be disabled, run every N frames or throttled to a time budget at runtime, without rebuilding the
+ * taskflow. Only the per-frame run is skipped, listeners connected in @ref ISystem::Setup stay connected. The
+ * graph also times each run of the systems, see @ref GetStats.
+ *
+ * A system which may be run less often than every frame must advance by the time elapsed since its own last run
+ * rather than by a single frame's @ref FrameTimer::DeltaTime, as the built-in script and particle systems do.
+ */
 class SystemGraph {
  public:
+  struct SystemStats {
+    std::string_view name;
+
+    /** @brief Wall time of the last run, including its parallel tasks. */
+    float            last_ms{0.0f};
+
+    /** @brief Exponential moving average of the run times. */
+    float            average_ms{0.0f};
+
+    double           total_ms{0.0};
+    uint64_t         run_count{0U};
+    uint64_t         skip_count{0U};
+
+    /** @brief Number of frames between the runs currently in effect. */
+    uint32_t         frame_interval{1U};
+  };
+
   void Emplace(std::unique_ptr<ISystem> system);
   void Insert(ISystem* system);
 
   tf::Taskflow Build(Scene& scene);
 
+  /**
+   * @brief Enable or disable running the system, can be called while the taskflow is running.
+   * @return Whether the system has been found.
+   */
+  bool SetEnabled(std::string_view name, bool enabled);
+
+  /**
+   * @brief Run the system once every frame_interval frames, can be called while the taskflow is running.
+   * @return Whether the system has been found.
+   */
+  bool SetFrameInterval(std::string_view name, uint32_t frame_interval);
+
+  /**
+   * @brief Run the system less often if its average run time exceeds the budget, so that it takes at most the
+   *        budget per frame on average. Zero disables the budget, can be called while the taskflow is running.
+   * @return Whether the system has been found.
+   */
+  bool SetBudget(std::string_view name, float budget_ms);
+
+  /**
+   * @brief Stats of the systems in insertion order, must not be read while the taskflow is running.
+   */
+  std::span<const SystemStats> GetStats() const;
+
  private:
   using OwnedSystemStorage = std::vector<std::unique_ptr<ISystem>>;
   using SystemList         = std::vector<ISystem*>;
   using Graph              = std::vector<entt::organizer::vertex>;
 
-  OwnedSystemStorage owned_systems_;
-  SystemList         systems_;
-  entt::organizer    organizer_;
-  Graph              graph_;
+  struct SystemControl {
+    std::atomic<bool>     enabled{true};
+    std::atomic<uint32_t> frame_interval{1U};
+    std::atomic<float>    budget_ms{0.0f};
+
+    /* Only accessed by the system's task */
+    uint32_t              wait_frames{0U};
+  };
+
+  static constexpr float kAverageWeight = 0.1f;
+
+  SystemControl* FindControl(std::string_view name);
+
+  bool ShouldRun(SystemControl& control, SystemStats& stats);
+  void RunSystem(uint32_t system_idx, Scene& scene, tf::Subflow& subflow);
+
+  OwnedSystemStorage        owned_systems_;
+  SystemList                systems_;
+  std::deque<SystemControl> controls_;
+  std::vector<SystemStats>  stats_;
+  entt::organizer           organizer_;
+  Graph                     graph_;
 };
 
-}  // namespace liger::ecs
\ No newline at end of file
+}  // namespace liger::ecs
@@ -27,16 +27,39 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/TypeSlot.hpp>
 #include <Liger-Engine/RHI/LogChannel.hpp>
 
-#include <any>
-#include <typeindex>
-#include <unordered_map>
+#include <array>
 
 namespace liger::rhi {
 
+/**
+ * @brief Type-indexed storage of per-frame render data shared between features and render graph jobs.
+ *
+ * Each data type gets a stable slot id on first use, so lookups are a plain array access. Data is
+ * stored in-place in a per-slot allocation made upon the first insertion, subsequent insertions
+ * assign to the existing object, which keeps references valid until @ref Remove.
+ *
+ * The slot array has a fixed size, so different data types can be inserted and accessed from
+ * different threads concurrently, e.g. by features running their PreRender in parallel.
+ */
 class Context {
  public:
+  /**
+   * @brief Max number of different data types.
+   */
+  static constexpr TypeSlotId kMaxDataTypes = 256;
+
+  Context() = default;
+  ~Context();
+
+  Context(const Context& other)            = delete;
+  Context& operator=(const Context& other) = delete;
+
+  Context(Context&& other)            = delete;
+  Context& operator=(Context&& other) = delete;
+
   template <typename Data>
   Data& Insert(Data data);
 
@@ -46,20 +69,86 @@ class Context {
   template <typename Data>
   void Remove();
 
+  template <typename Data>
+  bool Contains() const;
+
   template <typename Data>
   Data& Get();
 
   template <typename Data>
   const Data& Get() const;
 
+  template <typename Data>
+  Data* TryGet();
+
+  template <typename Data>
+  const Data* TryGet() const;
+
+  /**
+   * @brief Stable slot id of the data type, can be resolved once and passed to the slot accessors below.
+   *
+   * The slot accessors skip the slot lookup, the slot must have been resolved for the same data type.
+   */
+  template <typename Data>
+  static TypeSlotId Slot();
+
+  template <typename Data>
+  Data& Get(TypeSlotId slot);
+
+  template <typename Data>
+  const Data& Get(TypeSlotId slot) const;
+
+  template <typename Data>
+  Data* TryGet(TypeSlotId slot);
+
+  template <typename Data>
+  const Data* TryGet(TypeSlotId slot) const;
+
  private:
-  std::unordered_map<std::type_index, std::any> storage_;  // FIXME (tralf-strues): Come up with another way to store
+  struct Entry {
+    void* data{nullptr};
+    void (*destroy)(void*){nullptr};
+  };
+
+  template <typename Data>
+  Entry& GetEntry();
+
+  std::array<Entry, kMaxDataTypes> storage_{};
 };
 
+inline Context::~Context() {
+  for (auto& entry : storage_) {
+    if (entry.data != nullptr) {
+      entry.destroy(entry.data);
+    }
+  }
+}
+
+template <typename Data>
+TypeSlotId Context::Slot() {
+  return TypeSlot<Context, Data>::Value();
+}
+
+template <typename Data>
+Context::Entry& Context::GetEntry() {
+  const auto slot = Slot<Data>();
+  LIGER_ASSERT(slot < kMaxDataTypes, kLogChannelRHI, "Max number of context data types exceeded");
+
+  return storage_[slot];
+}
+
 template <typename Data>
 Data& Context::Insert(Data data) {
-  auto& result = (storage_[typeid(Data)] = std::move(data));
-  return std::any_cast<Data&>(result);
+  auto& entry = GetEntry<Data>();
+
+  if (entry.data == nullptr) {
+    entry.data    = new Data(std::move(data));
+    entry.destroy = [](void* ptr) { delete static_cast<Data*>(ptr); };
+  } else {
+    *static_cast<Data*>(entry.data) = std::move(data);
+  }
+
+  return *static_cast<Data*>(entry.data);
 }
 
 template <typename Data, typename... Args>
@@ -69,26 +158,62 @@ Data& Context::Emplace(Args&&... args) {
 
 template <typename Data>
 void Context::Remove() {
-  auto it = storage_.find(typeid(Data));
-  if (it != storage_.end()) {
-    storage_.erase(it);
+  const auto slot = Slot<Data>();
+  if (slot < storage_.size() && storage_[slot].data != nullptr) {
+    storage_[slot].destroy(storage_[slot].data);
+    storage_[slot] = Entry{};
   }
 }
 
 template <typename Data>
-Data& Context::Get() {
-  auto it = storage_.find(typeid(Data));
-  LIGER_ASSERT(it != storage_.end(), kLogChannelRHI, "Trying to access invalid data");
+bool Context::Contains() const {
+  return TryGet<Data>() != nullptr;
+}
 
-  return std::any_cast<Data&>(it->second);
+template <typename Data>
+Data& Context::Get() {
+  return Get<Data>(Slot<Data>());
 }
 
 template <typename Data>
 const Data& Context::Get() const {
-  auto it = storage_.find(typeid(Data));
-  LIGER_ASSERT(it != storage_.end(), kLogChannelRHI, "Trying to access invalid data");
+  return Get<Data>(Slot<Data>());
+}
+
+template <typename Data>
+Data* Context::TryGet() {
+  return TryGet<Data>(Slot<Data>());
+}
 
-  return std::any_cast<const Data&>(it->second);
+template <typename Data>
+const Data* Context::TryGet() const {
+  return TryGet<Data>(Slot<Data>());
+}
+
+template <typename Data>
+Data& Context::Get(TypeSlotId slot) {
+  auto* data = TryGet<Data>(slot);
+  LIGER_ASSERT(data, kLogChannelRHI, "Trying to access invalid data");
+
+  return *data;
+}
+
+template <typename Data>
+const Data& Context::Get(TypeSlotId slot) const {
+  const auto* data = TryGet<Data>(slot);
+  LIGER_ASSERT(data, kLogChannelRHI, "Trying to access invalid data");
+
+  return *data;
+}
+
+template <typename Data>
+Data* Context::TryGet(TypeSlotId slot) {
+  return (slot < storage_.size()) ? static_cast<Data*>(storage_[slot].data) : nullptr;
+}
+
+template <typename Data>
+const Data* Context::TryGet(TypeSlotId slot) const {
+  return (slot < storage_.size()) ? static_cast<const Data*>(storage_[slot].data) : nullptr;
 }
 
-}  // namespace liger::rhi
\ No newline at end of file
+}  // namespace liger::rhi
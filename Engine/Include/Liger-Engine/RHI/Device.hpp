@@ -91,6 +91,14 @@ class IDevice {
     Filter                     gen_mips_filter{Filter::Linear};
   };
 
+  /**
+   * @brief Device memory usage summed over all memory heaps.
+   */
+  struct MemoryUsage {
+    uint64_t used_bytes{0U};
+    uint64_t budget_bytes{0U};
+  };
+
   struct DedicatedTransferRequest {
     std::list<DedicatedBufferTransfer>  buffer_transfers;
     std::list<DedicatedTextureTransfer> texture_transfers;
@@ -121,6 +129,9 @@ class IDevice {
 
   /**
    * @brief Begin a frame with the specified swapchain as the main target if it is valid.
+   *
+   * Also starts a new @ref FrameArena frame, invalidating frame memory allocated before the call.
+   *
    * @param swapchain
    * @return Index of the swapchain texture for this frame or std::nullopt if swapchain recreation is needed.
    */
@@ -135,6 +146,8 @@ class IDevice {
 
   /**
    * @brief Begin an offscreen frame, i.e. without rendering and presenting to screen.
+   *
+   * Same as @ref BeginFrame, but no swapchain is needed, so it can be used for headless rendering.
    */
   virtual void BeginOffscreenFrame() = 0;
 
@@ -169,6 +182,11 @@ class IDevice {
 
   virtual void RequestDedicatedTransfer(DedicatedTransferRequest&& transfer) = 0;
 
+  /**
+   * @brief Get the current device memory usage and the budget available to the application.
+   */
+  [[nodiscard]] virtual MemoryUsage GetMemoryUsage() const = 0;
+
   /**
    * @brief Create a render graph builder, the object for constructing a render graph.
    * @return Render graph builder.
@@ -86,6 +86,12 @@ class RenderGraph {
   virtual void UpdateTransientBufferSize(ResourceVersion version, uint64_t new_size) = 0;
   virtual void DumpGraphviz(std::string_view filename, bool detailed) = 0;
 
+  /**
+   * @brief GPU time of the latest completed execution of the graph on the main queue.
+   * @return Time in milliseconds or std::nullopt if not available (yet).
+   */
+  virtual std::optional<float> LastGpuTimeMs() const = 0;
+
   void SetJob(std::string_view node_name, Job job);
 
  protected:
@@ -36,17 +36,22 @@ namespace liger::render {
 
 class CameraDataCollector : public IFeature, public ecs::ComponentSystem<const ecs::Camera, const ecs::WorldTransform> {
  public:
+  static constexpr std::string_view kName = "CameraDataCollector<const Camera, const WorldTransform>";
+
   explicit CameraDataCollector(rhi::IDevice& device);
   ~CameraDataCollector() override = default;
 
-  std::string_view Name() const override { return "CameraDataCollector<const Camera, const WorldTransform>"; }
+  std::string_view Name() const override { return kName; }
 
   void SetupEntitySystems(ecs::SystemGraph& systems) override;
   void Run(const ecs::Camera& camera, const ecs::WorldTransform& transform) override;
 
+  void Extract() override;
+
   void PreRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context& context) override;
 
  private:
+  RenderSnapshot<CameraData>          camera_data_;
   rhi::UniqueMappedBuffer<CameraData> ubo_camera_data_;
 };
 
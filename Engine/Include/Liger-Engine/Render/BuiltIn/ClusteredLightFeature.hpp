@@ -28,9 +28,11 @@
 #pragma once
 
 #include <Liger-Engine/Asset/Manager.hpp>
+#include <Liger-Engine/Core/Containers/WorkerLocal.hpp>
 #include <Liger-Engine/ECS/DefaultComponents.hpp>
 #include <Liger-Engine/RHI/ShaderAlignment.hpp>
 #include <Liger-Engine/Render/BuiltIn/CameraData.hpp>
+#include <Liger-Engine/Render/BuiltIn/CameraDataCollector.hpp>
 #include <Liger-Engine/Render/BuiltIn/ClusteredLightData.hpp>
 #include <Liger-Engine/Render/BuiltIn/OutputTexture.hpp>
 #include <Liger-Engine/Render/Feature.hpp>
@@ -40,23 +42,31 @@ namespace liger::render {
 
 class ClusteredLightFeature : public IFeature, ecs::ComponentSystem<const ecs::WorldTransform, const PointLightInfo> {
  public:
-  static constexpr uint32_t kClusterSizeXY       = 16U;
-  static constexpr uint32_t kMaxLightsPerCluster = 512U;
+  static constexpr uint32_t kClusterSizeXY        = 16U;
+  static constexpr uint32_t kMaxLightsPerCluster  = 512U;
+  static constexpr uint32_t kInitialLightCapacity = 64U;
 
-  explicit ClusteredLightFeature(asset::Manager& asset_manager);
+  ClusteredLightFeature(asset::Manager& asset_manager, tf::Executor& executor);
   ~ClusteredLightFeature() override = default;
 
   std::string_view Name() const override { return "ClusteredLightFeature"; }
 
+  std::span<const std::string_view> DependencyFeatures() const override { return kDependencies; }
+
   void SetupRenderGraph(rhi::RenderGraphBuilder& builder) override;
 
   void SetupEntitySystems(ecs::SystemGraph& systems) override;
   void Run(const ecs::WorldTransform& transform, const PointLightInfo& point_light) override;
 
+  void Extract() override;
+
   void PreRender(rhi::IDevice&, rhi::RenderGraph& graph, rhi::Context& context) override;
   void PostRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context&) override;
 
  private:
+  /* Cluster z-slices are computed from the camera data */
+  static constexpr std::array<std::string_view, 1> kDependencies{CameraDataCollector::kName};
+
   struct PointLight {
     SHADER_STRUCT_MEMBER(glm::vec3) ws_position;
     SHADER_STRUCT_MEMBER(float)     radius;
@@ -90,10 +100,15 @@ class ClusteredLightFeature : public IFeature, ecs::ComponentSystem<const ecs::W
     rhi::RenderGraph::ResourceVersion light_clusters;
   };
 
-  RenderGraphVersions     rg_versions_;
-  glm::uvec3              clusters_count_{1U, 1U, 32U};
-  bool                    updated_{false};
-  std::vector<PointLight> point_lights_;
+  /** Lights are appended to the calling worker's buffer, so the system can be run in parallel */
+  using PointLightBuffers = WorkerLocal<std::vector<PointLight>>;
+
+  tf::Executor&                     executor_;
+  RenderGraphVersions               rg_versions_;
+  glm::uvec3                        clusters_count_{1U, 1U, 32U};
+  bool                              updated_{false};
+  RenderSnapshot<PointLightBuffers> point_lights_;
+  uint32_t                          point_lights_count_{0U};
 };
 
 }  // namespace liger::render
\ No newline at end of file
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <Liger-Engine/Asset/Manager.hpp>
+#include <Liger-Engine/Core/Containers/SlotMap.hpp>
 #include <Liger-Engine/Core/Time.hpp>
 #include <Liger-Engine/ECS/DefaultComponents.hpp>
 #include <Liger-Engine/RHI/MappedBuffer.hpp>
@@ -66,9 +67,7 @@ struct Particle {
 };
 
 struct RuntimeParticleEmitterHandle {
-  static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
-
-  uint32_t runtime_handle{kInvalid};
+  SlotHandle runtime_handle;
 };
 
 class ParticleSystemFeature : public IFeature {
@@ -86,7 +85,23 @@ class ParticleSystemFeature : public IFeature {
 
   void SetupEntitySystems(ecs::SystemGraph& systems) override;
 
+  void Extract() override;
+
+  void PreRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context&) override;
+
   RuntimeParticleEmitterHandle Add(const ParticleEmitterInfo& emitter_info);
+
+  /**
+   * @brief Queue removing the emitter, its instance is destroyed once the frames in flight have retired.
+   */
+  void Remove(RuntimeParticleEmitterHandle handle);
+
+  /**
+   * @brief Re-register the emitter if its info cannot be applied to the existing instance.
+   * @return Handle of the emitter, the same one if it has not been re-registered.
+   */
+  RuntimeParticleEmitterHandle Replace(RuntimeParticleEmitterHandle handle, const ParticleEmitterInfo& emitter_info);
+
   void Update(RuntimeParticleEmitterHandle handle, const ParticleEmitterInfo& emitter_info, const glm::mat4& transform);
 
  private:
@@ -155,12 +170,33 @@ class ParticleSystemFeature : public IFeature {
     std::unique_ptr<rhi::IBuffer>                sbo_draw_command;
     std::unique_ptr<rhi::IBuffer>                sbo_draw_particle_indices;
 
+    ParticleEmitterUBO                           emitter_data;
+    bool                                         data_updated{false};
     glm::mat4                                    transform;
     float                                        pending_spawn{0.0f};
     uint32_t                                     max_particles{0U};
     bool                                         initialized{false};
   };
 
+  /** Emitter state written by the entity systems */
+  struct SimulatedEmitter {
+    ParticleEmitterUBO emitter_data;
+    glm::mat4          transform{1.0f};
+    float              spawn{0.0f};
+    float              last_update_time{-1.0f};
+    bool               updated{false};
+    uint32_t           max_particles{0U};
+    bool               removed{false};
+  };
+
+  /** Removed emitter, whose slot and instance are released once the frames in flight have retired */
+  struct RetiredEmitter {
+    SlotHandle handle;
+    uint64_t   extract_idx;
+  };
+
+  void CreateInstance(uint32_t idx, uint32_t max_particles);
+  void RetireEmitters();
   bool Initialized() const;
 
   rhi::IDevice&                 device_;
@@ -170,7 +206,16 @@ class ParticleSystemFeature : public IFeature {
   asset::Handle<shader::Shader> update_shader_;
   asset::Handle<shader::Shader> render_shader_;
 
+  /* Render side instances are indexed by the emitters' slot indices */
+  SlotMap<SimulatedEmitter>     emitters_{kMaxParticleSystems, FreeListPolicy::LowestIndexFirst};
   std::vector<Instance>         instances_;
+  std::vector<uint32_t>         active_instances_;
+
+  /** Removals queued by the component hooks, processed in a batch in Extract */
+  std::vector<SlotHandle>       pending_remove_;
+  std::vector<RetiredEmitter>   retired_emitters_;
+  uint64_t                      extract_count_{0U};
+
   std::unique_ptr<rhi::IBuffer> sbo_init_free_list_;
   RenderGraphVersions           rg_versions_;
 };
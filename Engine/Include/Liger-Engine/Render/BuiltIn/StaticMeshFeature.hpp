@@ -28,11 +28,17 @@
 #pragma once
 
 #include <Liger-Engine/Asset/Manager.hpp>
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
+#include <Liger-Engine/Core/Containers/WorkerLocal.hpp>
 #include <Liger-Engine/ECS/DefaultComponents.hpp>
+#include <Liger-Engine/ECS/SceneFormat.hpp>
 #include <Liger-Engine/RHI/ShaderAlignment.hpp>
 #include <Liger-Engine/Render/Feature.hpp>
 #include <Liger-Engine/ShaderSystem/Shader.hpp>
 
+#include <atomic>
+#include <mutex>
+
 namespace liger::render {
 
 struct Vertex3D {
@@ -92,6 +98,12 @@ struct StaticMesh {
   std::vector<Submesh> submeshes;
 };
 
+/**
+ * @brief Static mesh rendered at the entity's @ref ecs::WorldTransform.
+ *
+ * To change the mesh, modify it in-place and call registry.patch<StaticMeshComponent>(entity), so that the objects
+ * of the previous mesh are removed. Replacing the whole component loses the handles of the previous objects.
+ */
 struct StaticMeshComponent {
   static constexpr uint32_t kInvalidRuntimeHandle = std::numeric_limits<uint32_t>::max();
 
@@ -110,7 +122,7 @@ class StaticMeshFeature
     LightComplexity
   };
 
-  explicit StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset_manager);
+  StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset_manager, tf::Executor& executor);
   ~StaticMeshFeature() override = default;
 
   std::string_view Name() const override {
@@ -124,11 +136,15 @@ class StaticMeshFeature
 
   void SetupEntitySystems(ecs::SystemGraph& systems) override;
 
+  void Setup(entt::registry& registry) override;
   void Run(const ecs::WorldTransform& transform, StaticMeshComponent& static_mesh) override;
 
+  void Extract() override;
+
  private:
-  static constexpr uint32_t kMaxObjects = 512;
-  static constexpr uint32_t kMaxMeshes  = 256;
+  static constexpr uint32_t kMaxObjects         = 512;
+  static constexpr uint32_t kMaxMeshes          = 256;
+  static constexpr uint32_t kReservedObjectSlots = 64;
 
   struct Object {
     glm::mat4                    transform;
@@ -138,6 +154,33 @@ class StaticMeshFeature
     uint32_t                     index_count;
   };
 
+  struct AddedObject {
+    uint32_t      object_idx;
+    Object        object;
+    rhi::IBuffer* index_buffer;
+  };
+
+  /** Objects state written by the entity systems, one per worker */
+  struct SimulatedObjects {
+    std::vector<Transform3D> transforms;
+    std::vector<uint32_t>    transform_objects;
+    std::vector<AddedObject> added_objects;
+  };
+
+  using SimulatedSnapshot = RenderSnapshot<WorkerLocal<SimulatedObjects>>;
+
+  /** Removed object, whose slot is reused once the frames in flight that may still read it have retired */
+  struct RetiredObject {
+    uint32_t object_idx;
+    uint64_t extract_idx;
+  };
+
+  /** Buffer replaced while frames in flight may still use it */
+  struct RetiredBuffer {
+    std::unique_ptr<rhi::IBuffer> buffer;
+    uint64_t                      extract_idx;
+  };
+
   struct BatchedObject {
     uint32_t object_idx;
     uint32_t batch_idx;
@@ -156,25 +199,60 @@ class StaticMeshFeature
     rhi::RenderGraph::ResourceVersion batched_objects;
     rhi::RenderGraph::ResourceVersion draw_commands;
 
+    rhi::RenderGraph::ResourceVersion object_updates;
+    rhi::RenderGraph::ResourceVersion object_update_indices;
+    rhi::RenderGraph::ResourceVersion scattered_objects;
+
     rhi::RenderGraph::ResourceVersion final_draw_commands;
     rhi::RenderGraph::ResourceVersion visible_object_indices;
   };
 
-  uint32_t AddObject(Object object);
+  uint32_t AddObject(SimulatedObjects& simulated, Object object, rhi::IBuffer* index_buffer);
+  void RemoveObjects(StaticMeshComponent& static_mesh);
+  void RetireObjects();
+
+  void OnStaticMeshDestroy(entt::registry& registry, entt::entity entity);
+  void OnStaticMeshUpdate(entt::registry& registry, entt::entity entity);
+  void OnTransformDestroy(entt::registry& registry, entt::entity entity);
+
+  void ReserveObjectSlots();
+  void UpdateTransforms();
   void Rebuild(rhi::ICommandBuffer& cmds);
 
   DebugMode                            debug_mode_{DebugMode::Off};
 
   rhi::IDevice&                        device_;
+  tf::Executor&                        executor_;
   std::vector<Object>                  objects_;
-  bool                                 objects_added_{false};
+  std::vector<bool>                    objects_alive_;
+  uint32_t                             objects_end_{0U};
+  bool                                 objects_changed_{false};
+  FreeList                             object_slots_;
+
+  /** Removals queued by the component hooks, processed in a batch in Extract */
   std::vector<uint32_t>                pending_remove_;
-  std::unordered_set<uint32_t>         free_list_;
+  std::vector<RetiredObject>           retired_objects_;
+  uint64_t                             extract_count_{0U};
+
+  /**
+   * Slots taken by the entity systems with an atomic cursor, since they may run in parallel. Once they run out,
+   * slots are allocated under the lock, so that any number of objects can be added in a frame.
+   */
+  std::vector<uint32_t>                reserved_slots_;
+  std::atomic<uint32_t>                reserved_slots_used_{0U};
+  std::mutex                           object_slots_mutex_;
+
+  SimulatedSnapshot                    simulated_objects_;
+  /** Transforms last seen by the entity systems, so that only moved objects are uploaded */
+  std::vector<Transform3D>             last_transforms_;
+  std::vector<glm::mat4>               pending_matrices_;
+  std::vector<uint32_t>                dirty_objects_;
 
   std::vector<BatchedObject>           batched_objects_;
   std::vector<rhi::DrawIndexedCommand> draw_commands_;
 
   asset::Handle<shader::Shader>        cull_shader_;
+  asset::Handle<shader::Shader>        scatter_shader_;
   asset::Handle<shader::Shader>        render_shader_;
   std::unique_ptr<rhi::IBuffer>        sbo_objects_;
   std::unique_ptr<rhi::IBuffer>        sbo_batched_objects_;
@@ -183,9 +261,27 @@ class StaticMeshFeature
   std::vector<rhi::IBuffer*>           index_buffers_per_object_;
   std::unique_ptr<rhi::IBuffer>        merged_index_buffer_;
   uint64_t                             merged_index_buffer_total_size_;
+  std::vector<RetiredBuffer>           retired_index_buffers_;
   std::vector<CopyCmd>                 index_buffer_copies_;
 
   RenderGraphVersions                  rg_versions_;
 };
 
-}  // namespace liger::render
\ No newline at end of file
+}  // namespace liger::render
+
+namespace liger::ecs {
+
+template <>
+struct SceneComponentTraits<render::StaticMeshComponent> {
+  using Stored = asset::Id;
+
+  static Stored Save(const render::StaticMeshComponent& component, SceneWriteContext& context) {
+    return context.ReferenceAsset(component.mesh);
+  }
+
+  static render::StaticMeshComponent Load(Stored mesh_id, SceneReadContext& context) {
+    return render::StaticMeshComponent{.mesh = context.GetAsset<render::StaticMesh>(mesh_id)};
+  }
+};
+
+}  // namespace liger::ecs
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include <Liger-Engine/RHI/Device.hpp>
 #include <Liger-Engine/RHI/RenderGraph.hpp>
 #include <Liger-Engine/Render/Layer.hpp>
+#include <Liger-Engine/Render/RenderSnapshot.hpp>
 #include <Liger-Engine/ShaderSystem/DeclarationStack.hpp>
 
 namespace liger::render {
@@ -41,6 +42,12 @@ class IFeature {
 
   virtual std::string_view Name() const = 0;
 
+  /**
+   * @brief Names of the features whose PreRender/PostRender must run before this feature's ones, e.g. because
+   *        it reads the context data they insert.
+   *
+   * Otherwise PreRender/PostRender of different features may run concurrently, see @ref Renderer::AddFrameTasks.
+   */
   virtual std::span<const std::string_view> DependencyFeatures() const { return {}; }
   virtual std::span<Layer> Layers() { return {}; }
 
@@ -50,6 +57,13 @@ class IFeature {
 
   virtual void SetupEntitySystems(ecs::SystemGraph&) {}
 
+  /**
+   * @brief Hand the state written by the entity systems over to the render work, see @ref RenderSnapshot.
+   *
+   * Called when neither the entity systems nor the render work are running, so it should be as cheap as a swap.
+   */
+  virtual void Extract() {}
+
   virtual void PreRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context&) {}
   virtual void PostRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context&) {}
 };
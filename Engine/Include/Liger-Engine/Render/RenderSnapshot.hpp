@@ -0,0 +1,68 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file RenderSnapshot.hpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace liger::render {
+
+/**
+ * @brief Double-buffered state handed over from the entity systems to the render work of a feature.
+ *
+ * Entity systems of the frame being simulated write @ref Simulated, while the render work reads @ref Extracted, the
+ * state of the previously simulated frame. The buffers are swapped in @ref IFeature::Extract, so simulation of the
+ * next frame can overlap with the render work of the current one.
+ *
+ * @note Buffers are reused rather than reallocated, so keep containers' capacity when resetting the simulated state.
+ */
+template <typename T>
+class RenderSnapshot {
+ public:
+  T&       Simulated()       { return buffers_[simulated_idx_]; }
+  const T& Simulated() const { return buffers_[simulated_idx_]; }
+
+  T&       Extracted()       { return buffers_[simulated_idx_ ^ 1U]; }
+  const T& Extracted() const { return buffers_[simulated_idx_ ^ 1U]; }
+
+  /**
+   * @brief Make the simulated state the extracted one.
+   *
+   * @return Buffer to be simulated next, holding the state extracted on the previous call.
+   */
+  T& Extract() {
+    simulated_idx_ ^= 1U;
+    return Simulated();
+  }
+
+ private:
+  std::array<T, 2> buffers_{};
+  uint32_t         simulated_idx_{0U};
+};
+
+}  // namespace liger::render
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/Task/FrameTaskGraph.hpp>
 #include <Liger-Engine/Render/Feature.hpp>
 
 namespace liger::render {
@@ -36,6 +37,15 @@ class Renderer {
   using FeatureList        = std::vector<std::unique_ptr<IFeature>>;
   using DeclarationLibrary = std::unordered_map<std::string_view, shader::Declaration>;
 
+  /**
+   * @brief CPU time spent in each feature during the last @ref Render call.
+   */
+  struct FeatureStats {
+    std::string_view name;
+    float            pre_render_ms{0.0f};
+    float            post_render_ms{0.0f};
+  };
+
   explicit Renderer(rhi::IDevice& device);
 
   void EmplaceFeature(std::unique_ptr<IFeature> feature);
@@ -46,11 +56,54 @@ class Renderer {
   void Setup();
 
   tf::Taskflow GetSystemTaskflow(ecs::Scene& scene);
+  ecs::SystemGraph& GetSystemGraph();
   rhi::RenderGraph& GetRenderGraph();
 
+  /**
+   * @brief Extract the state of the frame simulated last and render it.
+   */
   void Render();
 
+  /**
+   * @brief Hand the state written by the entity systems over to the render work of all features.
+   *
+   * Must not overlap with the entity systems, the render work or other device work such as ending the frame, since
+   * features may create buffers and write descriptors here. Render work added with @ref AddFrameTasks renders the
+   * state extracted last, so it can overlap with simulation of the next frame.
+   */
+  void Extract();
+
+  /**
+   * @brief Add the render work of a frame to the frame task graph, an alternative to @ref Render.
+   *
+   * PreRender tasks of different features run concurrently, ordered only by @ref IFeature::DependencyFeatures.
+   * The render graph is executed once all of them complete, followed by the PostRender tasks. Only the state
+   * extracted by the last @ref Extract call is read, so the tasks may run concurrently with the entity systems.
+   *
+   * @param graph Frame task graph.
+   * @param after Task which must complete before the render work, e.g. the end of the simulation.
+   *
+   * @return Task marking the end of the render work.
+   */
+  FrameTaskGraph::TaskId AddFrameTasks(FrameTaskGraph& graph, FrameTaskGraph::TaskId after);
+
+  std::span<const FeatureStats> GetFeatureStats() const;
+
+  /**
+   * @brief CPU time spent recording and submitting the render graph during the last @ref Render call.
+   */
+  float GetExecuteTimeMs() const;
+
+  /**
+   * @brief CPU time spent in the last @ref Extract call.
+   */
+  float GetExtractTimeMs() const;
+
  private:
+  void PreRender(size_t feature_idx);
+  void Execute();
+  void PostRender(size_t feature_idx);
+
   rhi::IDevice&                     device_;
 
   FeatureList                       features_;
@@ -60,6 +113,10 @@ class Renderer {
   rhi::RenderGraphBuilder           rg_builder_;
   std::unique_ptr<rhi::RenderGraph> render_graph_;
   rhi::Context                      context_;
+
+  std::vector<FeatureStats>         feature_stats_;
+  float                             execute_time_ms_{0.0f};
+  float                             extract_time_ms_{0.0f};
 };
 
 }  // namespace liger::render
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file PrefabLoader.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Asset/Loaders/PrefabLoader.hpp>
+
+#include <Liger-Engine/Asset/LogChannel.hpp>
+#include <Liger-Engine/ECS/SceneFormat.hpp>
+
+namespace liger::asset::loaders {
+
+PrefabLoader::PrefabLoader(const ecs::SceneFormat& format) : format_(format) {}
+
+std::span<const std::filesystem::path> PrefabLoader::FileExtensions() const {
+  static std::array<std::filesystem::path, 1U> extension{".lprefab"};
+  return extension;
+}
+
+void PrefabLoader::Load(asset::Manager& manager, asset::Id asset_id, const std::filesystem::path& filepath) {
+  auto prefab = manager.GetAsset<ecs::Prefab>(asset_id);
+
+  ecs::SceneFile file;
+  if (!file.Open(filepath) || !format_.LoadPrefab(file, *prefab, manager)) {
+    LIGER_LOG_ERROR(kLogChannelAsset, "Failed to load prefab '{0}'", filepath.string());
+    prefab.UpdateState(asset::State::Invalid);
+    return;
+  }
+
+  prefab.UpdateState(asset::State::Loaded);
+}
+
+}  // namespace liger::asset::loaders
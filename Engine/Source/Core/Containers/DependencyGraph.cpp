@@ -39,18 +39,19 @@ DAG<void>::NodeHandle DAG<void>::DeclareNode() {
   return handle;
 }
 
-void DAG<void>::AddEdge(NodeHandle from, NodeHandle to) {
+bool DAG<void>::AddEdge(NodeHandle from, NodeHandle to) {
+  assert(from < adj_lists_.size() && to < adj_lists_.size());
+
+  if (!edges_.insert(EdgeKey(from, to)).second) {
+    return false;
+  }
+
   adj_lists_[from].push_back(to);
+  return true;
 }
 
 bool DAG<void>::EdgeExists(NodeHandle from, NodeHandle to) const {
-  for (auto adj_node_handle : adj_lists_[from]) {
-    if (adj_node_handle == to) {
-      return true;
-    }
-  }
-
-  return false;
+  return edges_.contains(EdgeKey(from, to));
 }
 
 const DAG<void>::AdjacencyList& DAG<void>::GetAdjacencyList(NodeHandle handle) const {
@@ -58,42 +59,109 @@ const DAG<void>::AdjacencyList& DAG<void>::GetAdjacencyList(NodeHandle handle) c
   return adj_lists_[handle];
 }
 
-bool DAG<void>::TopologicalSort(SortedList& out_sorted) {
-  std::vector<bool> visited(Size(), false);
-  std::vector<bool> on_stack(Size(), false);
+bool DAG<void>::TopologicalSort(SortedList& out_sorted) const {
+  DepthList depth;
+  Depth     max_depth{0};
+  return TopologicalSort(out_sorted, depth, max_depth);
+}
+
+bool DAG<void>::TopologicalSort(SortedList& out_sorted, DepthList& out_depth, Depth& out_max_depth) const {
+  const auto nodes_count = static_cast<NodeHandle>(Size());
+
+  std::vector<uint32_t> in_degree(nodes_count, 0);
+  for (const auto& adj_list : adj_lists_) {
+    for (auto to_handle : adj_list) {
+      ++in_degree[to_handle];
+    }
+  }
 
   out_sorted.clear();
+  out_sorted.reserve(nodes_count);
+
+  out_depth.assign(nodes_count, 0);
+  out_max_depth = 0;
+
+  for (NodeHandle handle = 0; handle < nodes_count; ++handle) {
+    if (in_degree[handle] == 0) {
+      out_sorted.push_back(handle);
+    }
+  }
 
-  for (NodeHandle from_handle = 0; from_handle < static_cast<NodeHandle>(Size()); ++from_handle) {
-    if (visited[from_handle]) {
-      continue;
+  /* Nodes in [level_begin, level_end) form the current level, their dependents whose last dependency
+     is in this level form the next one */
+  size_t level_begin = 0;
+  while (level_begin < out_sorted.size()) {
+    const size_t level_end = out_sorted.size();
+
+    for (size_t sort_idx = level_begin; sort_idx < level_end; ++sort_idx) {
+      for (auto to_handle : adj_lists_[out_sorted[sort_idx]]) {
+        if (--in_degree[to_handle] == 0) {
+          out_depth[to_handle] = out_max_depth + 1;
+          out_sorted.push_back(to_handle);
+        }
+      }
     }
 
-    if (!TopologicalSortDFS(out_sorted, from_handle, visited, on_stack)) {
-      return false;
+    std::sort(out_sorted.begin() + static_cast<std::ptrdiff_t>(level_end), out_sorted.end());
+
+    if (level_end < out_sorted.size()) {
+      ++out_max_depth;
     }
+
+    level_begin = level_end;
   }
 
-  std::reverse(out_sorted.begin(), out_sorted.end());
-  return true;
+  return out_sorted.size() == nodes_count;
 }
 
-bool DAG<void>::TopologicalSort(SortedList& out_sorted, DepthList& out_depth, Depth& out_max_depth) {
-  if (!TopologicalSort(out_sorted)) {
+bool DAG<void>::TransitiveReduction() {
+  const auto nodes_count = static_cast<NodeHandle>(Size());
+
+  SortedList sorted;
+  if (!TopologicalSort(sorted)) {
     return false;
   }
 
-  CalculateDepths(out_sorted, out_depth, out_max_depth);
-
-  std::vector<uint32_t> handle_to_sort_idx(out_sorted.size());
-  for (uint32_t sort_idx = 0U; sort_idx < out_sorted.size(); ++sort_idx) {
-    handle_to_sort_idx[out_sorted[sort_idx]] = sort_idx;
+  std::vector<SortedIndex> sort_idx_from_handle(nodes_count);
+  for (SortedIndex sort_idx = 0; sort_idx < nodes_count; ++sort_idx) {
+    sort_idx_from_handle[sorted[sort_idx]] = sort_idx;
   }
 
-  std::sort(out_sorted.begin(), out_sorted.end(), [&](NodeHandle lhs, NodeHandle rhs) {
-    return (out_depth[lhs] < out_depth[rhs]) ||
-           (out_depth[lhs] == out_depth[rhs] && handle_to_sort_idx[lhs] < handle_to_sort_idx[rhs]);
-  });
+  /* reachable[handle] is a bitset of nodes reachable from the node (including itself) */
+  const size_t          words_per_node = (nodes_count + 63U) / 64U;
+  std::vector<uint64_t> reachable(static_cast<size_t>(nodes_count) * words_per_node, 0U);
+
+  auto reachable_row = [&](NodeHandle handle) { return reachable.data() + handle * words_per_node; };
+
+  for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+    const NodeHandle from_handle = *it;
+    uint64_t*        from_row    = reachable_row(from_handle);
+    auto&            adj_list    = adj_lists_[from_handle];
+
+    /* Visiting dependents in topological order guarantees that if one dependent is reachable through
+       another, the latter has been visited and merged into from_row by then */
+    std::sort(adj_list.begin(), adj_list.end(), [&](NodeHandle lhs, NodeHandle rhs) {
+      return sort_idx_from_handle[lhs] < sort_idx_from_handle[rhs];
+    });
+
+    size_t kept = 0;
+    for (auto to_handle : adj_list) {
+      if ((from_row[to_handle / 64U] >> (to_handle % 64U)) & 1U) {
+        edges_.erase(EdgeKey(from_handle, to_handle));
+        continue;
+      }
+
+      const uint64_t* to_row = reachable_row(to_handle);
+      for (size_t word = 0; word < words_per_node; ++word) {
+        from_row[word] |= to_row[word];
+      }
+
+      adj_list[kept++] = to_handle;
+    }
+
+    adj_list.resize(kept);
+    from_row[from_handle / 64U] |= uint64_t{1} << (from_handle % 64U);
+  }
 
   return true;
 }
@@ -102,9 +170,14 @@ size_t DAG<void>::Size() const {
   return adj_lists_.size();
 }
 
+size_t DAG<void>::EdgeCount() const {
+  return edges_.size();
+}
+
 DAG<void> DAG<void>::Reverse() const {
   DAG<void> reverse_dag;
   reverse_dag.adj_lists_.resize(Size());
+  reverse_dag.edges_.reserve(edges_.size());
 
   for (NodeHandle from = 0; from < Size(); ++from) {
     for (auto to : GetAdjacencyList(from)) {
@@ -115,41 +188,8 @@ DAG<void> DAG<void>::Reverse() const {
   return reverse_dag;
 }
 
-bool DAG<void>::TopologicalSortDFS(SortedList& out_sorted, NodeHandle from_handle, DFSVisitedList& visited,
-                                   DFSOnStackList& on_stack) {
-  visited[from_handle]  = true;
-  on_stack[from_handle] = true;
-
-  for (NodeHandle to_handle : adj_lists_[from_handle]) {
-    if (visited[to_handle] && on_stack[to_handle]) {
-      return false;
-    }
-
-    if (visited[to_handle]) {
-      continue;
-    }
-
-    if (!TopologicalSortDFS(out_sorted, to_handle, visited, on_stack)) {
-      return false;
-    }
-  }
-
-  on_stack[from_handle] = false;
-  out_sorted.push_back(from_handle);
-
-  return true;
-}
-
-void DAG<void>::CalculateDepths(const SortedList& sorted, DepthList& out_depth, Depth& out_max_depth) {
-  out_depth.resize(Size());
-  std::fill(out_depth.begin(), out_depth.end(), 0);
-
-  for (auto from_handle : sorted) {
-    for (auto to_handle : adj_lists_[from_handle]) {
-      out_depth[to_handle] = std::max(out_depth[to_handle], out_depth[from_handle] + 1);
-      out_max_depth = std::max(out_max_depth, out_depth[to_handle]);
-    }
-  }
+uint64_t DAG<void>::EdgeKey(NodeHandle from, NodeHandle to) {
+  return (static_cast<uint64_t>(from) << 32U) | static_cast<uint64_t>(to);
 }
 
-}  // namespace liger
\ No newline at end of file
+}  // namespace liger
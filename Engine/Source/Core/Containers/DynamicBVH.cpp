@@ -0,0 +1,461 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file DynamicBVH.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Containers/DynamicBVH.hpp>
+
+#include <Liger-Engine/Core/Log/Log.hpp>
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+namespace liger {
+
+namespace {
+
+constexpr uint32_t kMinNodeCapacity = 16U;
+constexpr uint32_t kBinCount        = 16U;
+
+}  // namespace
+
+DynamicBVH::DynamicBVH() : DynamicBVH(Policy{}) {}
+
+DynamicBVH::DynamicBVH(Policy policy) : policy_(policy) {}
+
+uint32_t DynamicBVH::CreateProxy(const AABB& box, uint32_t user_data) {
+  const uint32_t leaf = AllocateNode();
+
+  auto& node     = nodes_[leaf];
+  node.box       = Enlarge(box);
+  node.tight_box = box;
+  node.user_data = user_data;
+
+  InsertLeaf(leaf);
+  ++proxy_count_;
+
+  return leaf;
+}
+
+void DynamicBVH::DestroyProxy(uint32_t proxy) {
+  LIGER_ASSERT(node_ids_.IsAllocated(proxy) && nodes_[proxy].IsLeaf(), kLogChannelCore, "Invalid BVH proxy");
+
+  RemoveLeaf(proxy);
+  FreeNode(proxy);
+  --proxy_count_;
+}
+
+bool DynamicBVH::MoveProxy(uint32_t proxy, const AABB& box) {
+  LIGER_ASSERT(node_ids_.IsAllocated(proxy) && nodes_[proxy].IsLeaf(), kLogChannelCore, "Invalid BVH proxy");
+
+  auto& node     = nodes_[proxy];
+  node.tight_box = box;
+
+  if (node.box.Contains(box)) {
+    return false;
+  }
+
+  /* Ancestors are refitted when the leaf is removed, so the new box can be set right away */
+  node.box = Enlarge(box);
+
+  if (!node.moved) {
+    node.moved = true;
+    moved_.push_back(proxy);
+  }
+
+  return true;
+}
+
+void DynamicBVH::Commit() {
+  const bool rebuild = static_cast<float>(moved_.size()) > policy_.rebuild_moved_fraction * static_cast<float>(proxy_count_);
+
+  if (rebuild) {
+    Rebuild();
+    return;
+  }
+
+  for (auto proxy : moved_) {
+    /* The proxy might have been destroyed after moving */
+    if (!nodes_[proxy].moved) {
+      continue;
+    }
+
+    nodes_[proxy].moved = false;
+    RemoveLeaf(proxy);
+    InsertLeaf(proxy);
+  }
+
+  moved_.clear();
+
+  if (proxy_count_ > 1U && CostPerLeaf() > policy_.rebuild_cost_ratio * built_cost_per_leaf_) {
+    Rebuild();
+  }
+}
+
+void DynamicBVH::Rebuild() {
+  std::vector<uint32_t> leaves;
+  leaves.reserve(proxy_count_);
+
+  node_ids_.ForEachAllocated([this, &leaves](uint32_t node) {
+    if (nodes_[node].IsLeaf()) {
+      leaves.push_back(node);
+    } else {
+      FreeNode(node);
+    }
+  });
+
+  for (auto leaf : leaves) {
+    nodes_[leaf].moved = false;
+  }
+
+  moved_.clear();
+  cost_ = 0.0f;
+  root_ = kNullNode;
+
+  if (!leaves.empty()) {
+    root_                = BuildRange(leaves);
+    nodes_[root_].parent = kNullNode;
+  }
+
+  built_cost_per_leaf_ = CostPerLeaf();
+}
+
+void DynamicBVH::Clear() {
+  nodes_.clear();
+  node_ids_ = FreeList();
+  moved_.clear();
+
+  root_                = kNullNode;
+  proxy_count_         = 0U;
+  cost_                = 0.0f;
+  built_cost_per_leaf_ = 0.0f;
+}
+
+uint32_t DynamicBVH::GetUserData(uint32_t proxy) const { return nodes_[proxy].user_data; }
+
+const AABB& DynamicBVH::GetBox(uint32_t proxy) const { return nodes_[proxy].tight_box; }
+
+uint32_t DynamicBVH::ProxyCount() const { return proxy_count_; }
+
+uint32_t DynamicBVH::Height() const {
+  return root_ != kNullNode ? static_cast<uint32_t>(nodes_[root_].height) : 0U;
+}
+
+float DynamicBVH::Cost() const { return cost_; }
+
+float DynamicBVH::CostPerLeaf() const {
+  return proxy_count_ > 0U ? cost_ / static_cast<float>(proxy_count_) : 0.0f;
+}
+
+uint32_t DynamicBVH::AllocateNode() {
+  if (node_ids_.Full()) {
+    node_ids_.Grow(std::max(kMinNodeCapacity, 2U * node_ids_.Capacity()));
+    nodes_.resize(node_ids_.Capacity());
+  }
+
+  const uint32_t node = node_ids_.Allocate();
+  nodes_[node] = Node{};
+
+  return node;
+}
+
+void DynamicBVH::FreeNode(uint32_t node) {
+  if (!nodes_[node].IsLeaf() && !nodes_[node].box.Empty()) {
+    cost_ -= nodes_[node].box.SurfaceArea();
+  }
+
+  nodes_[node].moved = false;
+  node_ids_.Free(node);
+}
+
+AABB DynamicBVH::Enlarge(const AABB& box) const {
+  return box.Enlarged(policy_.relative_margin * (box.max - box.min) + glm::vec3(policy_.absolute_margin));
+}
+
+void DynamicBVH::SetInternalBox(uint32_t node, const AABB& box) {
+  /* Newly allocated nodes have an empty box */
+  const float old_area = nodes_[node].box.Empty() ? 0.0f : nodes_[node].box.SurfaceArea();
+
+  cost_ += box.SurfaceArea() - old_area;
+  nodes_[node].box = box;
+}
+
+void DynamicBVH::Refit(uint32_t node_idx) {
+  auto&       node   = nodes_[node_idx];
+  const auto& child0 = nodes_[node.children[0]];
+  const auto& child1 = nodes_[node.children[1]];
+
+  node.height = 1 + std::max(child0.height, child1.height);
+  SetInternalBox(node_idx, Union(child0.box, child1.box));
+}
+
+/**
+ * Descends to the sibling with the lowest SAH cost increase, stopping once making the current node
+ * the sibling is cheaper than descending any further (Box2D's dynamic tree heuristic).
+ */
+void DynamicBVH::InsertLeaf(uint32_t leaf) {
+  if (root_ == kNullNode) {
+    root_                = leaf;
+    nodes_[leaf].parent = kNullNode;
+    return;
+  }
+
+  const AABB box = nodes_[leaf].box;
+
+  uint32_t sibling = root_;
+  while (!nodes_[sibling].IsLeaf()) {
+    const auto& node = nodes_[sibling];
+
+    const float area          = node.box.SurfaceArea();
+    const float combined_area = Union(node.box, box).SurfaceArea();
+
+    /* Cost of making a new parent for this node and the leaf, and the cost pushed down to the children */
+    const float cost        = 2.0f * combined_area;
+    const float inheritance = 2.0f * (combined_area - area);
+
+    auto child_cost = [&](uint32_t child_idx) {
+      const auto& child = nodes_[child_idx];
+      const float union_area = Union(child.box, box).SurfaceArea();
+      return (child.IsLeaf() ? union_area : union_area - child.box.SurfaceArea()) + inheritance;
+    };
+
+    const float cost0 = child_cost(node.children[0]);
+    const float cost1 = child_cost(node.children[1]);
+
+    if (cost < cost0 && cost < cost1) {
+      break;
+    }
+
+    sibling = cost0 < cost1 ? node.children[0] : node.children[1];
+  }
+
+  const uint32_t old_parent = nodes_[sibling].parent;
+  const uint32_t new_parent = AllocateNode();
+
+  nodes_[new_parent].parent   = old_parent;
+  nodes_[new_parent].children = {sibling, leaf};
+  nodes_[new_parent].height   = nodes_[sibling].height + 1;
+  SetInternalBox(new_parent, Union(box, nodes_[sibling].box));
+
+  if (old_parent != kNullNode) {
+    auto& children = nodes_[old_parent].children;
+    children[children[0] == sibling ? 0U : 1U] = new_parent;
+  } else {
+    root_ = new_parent;
+  }
+
+  nodes_[sibling].parent = new_parent;
+  nodes_[leaf].parent    = new_parent;
+
+  for (uint32_t node = new_parent; node != kNullNode; node = nodes_[node].parent) {
+    node = Balance(node);
+    Refit(node);
+  }
+}
+
+void DynamicBVH::RemoveLeaf(uint32_t leaf) {
+  if (leaf == root_) {
+    root_ = kNullNode;
+    return;
+  }
+
+  const uint32_t parent       = nodes_[leaf].parent;
+  const uint32_t grand_parent = nodes_[parent].parent;
+  const auto&    siblings     = nodes_[parent].children;
+  const uint32_t sibling      = siblings[0] == leaf ? siblings[1] : siblings[0];
+
+  FreeNode(parent);
+  nodes_[sibling].parent = grand_parent;
+  nodes_[leaf].parent    = kNullNode;
+
+  if (grand_parent == kNullNode) {
+    root_ = sibling;
+    return;
+  }
+
+  auto& children = nodes_[grand_parent].children;
+  children[children[0] == parent ? 0U : 1U] = sibling;
+
+  for (uint32_t node = grand_parent; node != kNullNode; node = nodes_[node].parent) {
+    node = Balance(node);
+    Refit(node);
+  }
+}
+
+/**
+ * Rotates the higher child up if the children's heights differ by more than 1, the grandchild
+ * with the greater height stays under the rotated child. Returns the subtree's new root.
+ */
+uint32_t DynamicBVH::Balance(uint32_t a) {
+  if (nodes_[a].IsLeaf() || nodes_[a].height < 2) {
+    return a;
+  }
+
+  const uint32_t b       = nodes_[a].children[0];
+  const uint32_t c       = nodes_[a].children[1];
+  const int32_t  balance = nodes_[c].height - nodes_[b].height;
+
+  if (balance >= -1 && balance <= 1) {
+    return a;
+  }
+
+  /* Rotate the higher child up, the other child stays under a */
+  const uint32_t up       = balance > 1 ? c : b;
+  const uint32_t stays    = balance > 1 ? b : c;
+  const uint32_t up_slot  = balance > 1 ? 1U : 0U;
+
+  const uint32_t f = nodes_[up].children[0];
+  const uint32_t g = nodes_[up].children[1];
+
+  nodes_[up].children[0] = a;
+  nodes_[up].parent      = nodes_[a].parent;
+  nodes_[a].parent       = up;
+
+  if (nodes_[up].parent != kNullNode) {
+    auto& children = nodes_[nodes_[up].parent].children;
+    children[children[0] == a ? 0U : 1U] = up;
+  } else {
+    root_ = up;
+  }
+
+  /* The higher grandchild stays under up, the other one takes up's place under a */
+  const bool     keep_f = nodes_[f].height > nodes_[g].height;
+  const uint32_t kept   = keep_f ? f : g;
+  const uint32_t moved  = keep_f ? g : f;
+
+  nodes_[up].children[1]     = kept;
+  nodes_[a].children[up_slot] = moved;
+  nodes_[moved].parent       = a;
+
+  nodes_[a].height = 1 + std::max(nodes_[stays].height, nodes_[moved].height);
+  SetInternalBox(a, Union(nodes_[stays].box, nodes_[moved].box));
+
+  nodes_[up].height = 1 + std::max(nodes_[a].height, nodes_[kept].height);
+  SetInternalBox(up, Union(nodes_[a].box, nodes_[kept].box));
+
+  return up;
+}
+
+/**
+ * Splits the leaves along the axis of the largest centroid extent, at the bin boundary with the
+ * lowest SAH cost. Falls back to a median split if all centroids fall into one bin.
+ */
+uint32_t DynamicBVH::BuildRange(std::span<uint32_t> leaves) {
+  if (leaves.size() == 1U) {
+    return leaves.front();
+  }
+
+  AABB centroid_bounds;
+  for (auto leaf : leaves) {
+    centroid_bounds.Expand(nodes_[leaf].box.Center());
+  }
+
+  const glm::vec3 centroid_size = centroid_bounds.max - centroid_bounds.min;
+
+  uint32_t axis = 0U;
+  if (centroid_size.y > centroid_size[axis]) {
+    axis = 1U;
+  }
+  if (centroid_size.z > centroid_size[axis]) {
+    axis = 2U;
+  }
+
+  auto middle = leaves.begin() + static_cast<ptrdiff_t>(leaves.size() / 2U);
+
+  if (centroid_size[axis] > 0.0f) {
+    struct Bin {
+      AABB     box;
+      uint32_t count{0U};
+    };
+
+    std::array<Bin, kBinCount> bins{};
+
+    const float scale = static_cast<float>(kBinCount) / centroid_size[axis];
+    auto bin_of = [&](uint32_t leaf) {
+      const float offset = nodes_[leaf].box.Center()[axis] - centroid_bounds.min[axis];
+      return std::min(kBinCount - 1U, static_cast<uint32_t>(offset * scale));
+    };
+
+    for (auto leaf : leaves) {
+      auto& bin = bins[bin_of(leaf)];
+      bin.box.Expand(nodes_[leaf].box);
+      ++bin.count;
+    }
+
+    /* Sweep from the right to get the cost of the right side of each split */
+    std::array<float, kBinCount> right_costs{};
+
+    AABB     right_box;
+    uint32_t right_count = 0U;
+    for (uint32_t bin_idx = kBinCount - 1U; bin_idx > 0U; --bin_idx) {
+      right_box.Expand(bins[bin_idx].box);
+      right_count += bins[bin_idx].count;
+      right_costs[bin_idx] = right_count > 0U ? right_box.SurfaceArea() * static_cast<float>(right_count) : 0.0f;
+    }
+
+    AABB     left_box;
+    uint32_t left_count = 0U;
+    uint32_t best_split = 0U;
+    float    best_cost  = std::numeric_limits<float>::max();
+    for (uint32_t split = 1U; split < kBinCount; ++split) {
+      left_box.Expand(bins[split - 1U].box);
+      left_count += bins[split - 1U].count;
+
+      if (left_count == 0U || left_count == leaves.size()) {
+        continue;
+      }
+
+      const float cost = left_box.SurfaceArea() * static_cast<float>(left_count) + right_costs[split];
+      if (cost < best_cost) {
+        best_cost  = cost;
+        best_split = split;
+      }
+    }
+
+    if (best_split != 0U) {
+      middle = std::partition(leaves.begin(), leaves.end(), [&](uint32_t leaf) { return bin_of(leaf) < best_split; });
+    }
+  }
+
+  if (centroid_size[axis] <= 0.0f || middle == leaves.begin() || middle == leaves.end()) {
+    middle = leaves.begin() + static_cast<ptrdiff_t>(leaves.size() / 2U);
+    std::nth_element(leaves.begin(), middle, leaves.end(), [&](uint32_t lhs, uint32_t rhs) {
+      return nodes_[lhs].box.Center()[axis] < nodes_[rhs].box.Center()[axis];
+    });
+  }
+
+  const auto split_idx = static_cast<size_t>(middle - leaves.begin());
+
+  const uint32_t node  = AllocateNode();
+  const uint32_t left  = BuildRange(leaves.subspan(0U, split_idx));
+  const uint32_t right = BuildRange(leaves.subspan(split_idx));
+
+  nodes_[node].children = {left, right};
+  nodes_[left].parent   = node;
+  nodes_[right].parent  = node;
+  Refit(node);
+
+  return node;
+}
+
+}  // namespace liger
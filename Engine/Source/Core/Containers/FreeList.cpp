@@ -0,0 +1,142 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FreeList.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
+
+#include <Liger-Engine/Core/Log/Log.hpp>
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+namespace liger {
+
+FreeList::FreeList(uint32_t capacity, FreeListPolicy policy) : policy_(policy) {
+  Grow(capacity);
+}
+
+uint32_t FreeList::Allocate() {
+  if (Full()) {
+    return kInvalidIndex;
+  }
+
+  uint32_t index = kInvalidIndex;
+
+  if (policy_ == FreeListPolicy::Lifo) {
+    index = free_stack_.back();
+    free_stack_.pop_back();
+  } else {
+    while (free_bits_[first_free_word_] == 0U) {
+      ++first_free_word_;
+    }
+
+    index = first_free_word_ * kWordBits + static_cast<uint32_t>(std::countr_zero(free_bits_[first_free_word_]));
+  }
+
+  free_bits_[index / kWordBits] &= ~(uint64_t{1U} << (index % kWordBits));
+  ++size_;
+
+  return index;
+}
+
+void FreeList::Free(uint32_t index) {
+  LIGER_ASSERT(IsAllocated(index), kLogChannelCore, "Trying to free index {0}, which is not allocated", index);
+
+  const uint32_t word_idx = index / kWordBits;
+
+  free_bits_[word_idx] |= uint64_t{1U} << (index % kWordBits);
+  --size_;
+
+  if (policy_ == FreeListPolicy::Lifo) {
+    free_stack_.push_back(index);
+  } else if (word_idx < first_free_word_) {
+    first_free_word_ = word_idx;
+  }
+}
+
+void FreeList::Grow(uint32_t new_capacity) {
+  if (new_capacity <= capacity_) {
+    return;
+  }
+
+  const uint32_t old_capacity = capacity_;
+  capacity_ = new_capacity;
+
+  /* Bits past the capacity are never set, so the scans stop at the capacity */
+  free_bits_.resize((capacity_ + kWordBits - 1U) / kWordBits, 0U);
+  for (uint32_t index = old_capacity; index < capacity_; ++index) {
+    free_bits_[index / kWordBits] |= uint64_t{1U} << (index % kWordBits);
+  }
+
+  if (policy_ == FreeListPolicy::Lifo) {
+    /* Reversed, so that lower indices are allocated first */
+    free_stack_.reserve(capacity_);
+    for (uint32_t index = capacity_; index > old_capacity; --index) {
+      free_stack_.push_back(index - 1U);
+    }
+  } else if (old_capacity / kWordBits < first_free_word_) {
+    first_free_word_ = old_capacity / kWordBits;
+  }
+}
+
+void FreeList::Clear() {
+  const uint32_t capacity = capacity_;
+
+  capacity_        = 0U;
+  size_            = 0U;
+  first_free_word_ = 0U;
+  free_bits_.clear();
+  free_stack_.clear();
+
+  Grow(capacity);
+}
+
+bool FreeList::IsAllocated(uint32_t index) const {
+  return index < capacity_ && (free_bits_[index / kWordBits] & (uint64_t{1U} << (index % kWordBits))) == 0U;
+}
+
+uint32_t FreeList::Size() const { return size_; }
+
+uint32_t FreeList::Capacity() const { return capacity_; }
+
+bool FreeList::Full() const { return size_ == capacity_; }
+
+uint32_t FreeList::End() const {
+  for (auto word_idx = static_cast<uint32_t>(free_bits_.size()); word_idx > 0U; --word_idx) {
+    uint64_t allocated = ~free_bits_[word_idx - 1U];
+
+    /* Bits past the capacity are never free, but are not allocated either */
+    if (word_idx * kWordBits > capacity_) {
+      allocated &= (uint64_t{1U} << (capacity_ % kWordBits)) - 1U;
+    }
+
+    if (allocated != 0U) {
+      return (word_idx - 1U) * kWordBits + (kWordBits - static_cast<uint32_t>(std::countl_zero(allocated)));
+    }
+  }
+
+  return 0U;
+}
+
+}  // namespace liger
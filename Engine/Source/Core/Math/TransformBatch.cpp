@@ -0,0 +1,453 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file TransformBatch.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Math/TransformBatch.hpp>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace liger::transform_batch {
+
+namespace {
+
+#if defined(__AVX2__)
+#define LIGER_TRANSFORM_BATCH_SIMD
+
+using Lane = __m256;
+
+constexpr size_t kLaneWidth = 8;
+
+inline Lane Set1(float value)             { return _mm256_set1_ps(value); }
+inline Lane Load(const float* src)        { return _mm256_loadu_ps(src); }
+inline void Store(float* dst, Lane value) { _mm256_storeu_ps(dst, value); }
+inline Lane Add(Lane lhs, Lane rhs)       { return _mm256_add_ps(lhs, rhs); }
+inline Lane Sub(Lane lhs, Lane rhs)       { return _mm256_sub_ps(lhs, rhs); }
+inline Lane Mul(Lane lhs, Lane rhs)       { return _mm256_mul_ps(lhs, rhs); }
+inline Lane Div(Lane lhs, Lane rhs)       { return _mm256_div_ps(lhs, rhs); }
+#elif defined(__SSE4_1__)
+#define LIGER_TRANSFORM_BATCH_SIMD
+
+using Lane = __m128;
+
+constexpr size_t kLaneWidth = 4;
+
+inline Lane Set1(float value)             { return _mm_set1_ps(value); }
+inline Lane Load(const float* src)        { return _mm_loadu_ps(src); }
+inline void Store(float* dst, Lane value) { _mm_storeu_ps(dst, value); }
+inline Lane Add(Lane lhs, Lane rhs)       { return _mm_add_ps(lhs, rhs); }
+inline Lane Sub(Lane lhs, Lane rhs)       { return _mm_sub_ps(lhs, rhs); }
+inline Lane Mul(Lane lhs, Lane rhs)       { return _mm_mul_ps(lhs, rhs); }
+inline Lane Div(Lane lhs, Lane rhs)       { return _mm_div_ps(lhs, rhs); }
+#else
+using Lane = float;
+
+constexpr size_t kLaneWidth = 1;
+
+inline Lane Set1(float value)             { return value; }
+inline Lane Load(const float* src)        { return *src; }
+inline void Store(float* dst, Lane value) { *dst = value; }
+inline Lane Add(Lane lhs, Lane rhs)       { return lhs + rhs; }
+inline Lane Sub(Lane lhs, Lane rhs)       { return lhs - rhs; }
+inline Lane Mul(Lane lhs, Lane rhs)       { return lhs * rhs; }
+inline Lane Div(Lane lhs, Lane rhs)       { return lhs / rhs; }
+#endif
+
+enum InputComponent : uint32_t {
+  kPositionX = 0,
+  kPositionY,
+  kPositionZ,
+  kRotationX,
+  kRotationY,
+  kRotationZ,
+  kRotationW,
+  kScaleX,
+  kScaleY,
+  kScaleZ,
+
+  kInputComponentsCount
+};
+
+struct Input {
+  Lane position[3];
+  Lane scale[3];
+
+  /* Rotation matrix, r[row][column] */
+  Lane r[3][3];
+};
+
+/* Values for unused lanes of a partial block, chosen so that no division by zero happens */
+constexpr float kPaddingValues[kInputComponentsCount] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+
+Input PrepareInput(const float (&components)[kInputComponentsCount][kLaneWidth]) {
+  Input input;
+
+  for (uint32_t i = 0; i < 3; ++i) {
+    input.position[i] = Load(components[kPositionX + i]);
+    input.scale[i]    = Load(components[kScaleX + i]);
+  }
+
+  const Lane x = Load(components[kRotationX]);
+  const Lane y = Load(components[kRotationY]);
+  const Lane z = Load(components[kRotationZ]);
+  const Lane w = Load(components[kRotationW]);
+
+  const Lane one = Set1(1.0f);
+  const Lane two = Set1(2.0f);
+
+  const Lane xx = Mul(x, x);
+  const Lane yy = Mul(y, y);
+  const Lane zz = Mul(z, z);
+  const Lane xy = Mul(x, y);
+  const Lane xz = Mul(x, z);
+  const Lane yz = Mul(y, z);
+  const Lane wx = Mul(w, x);
+  const Lane wy = Mul(w, y);
+  const Lane wz = Mul(w, z);
+
+  /* Same as glm::mat3_cast */
+  input.r[0][0] = Sub(one, Mul(two, Add(yy, zz)));
+  input.r[0][1] = Mul(two, Sub(xy, wz));
+  input.r[0][2] = Mul(two, Add(xz, wy));
+
+  input.r[1][0] = Mul(two, Add(xy, wz));
+  input.r[1][1] = Sub(one, Mul(two, Add(xx, zz)));
+  input.r[1][2] = Mul(two, Sub(yz, wx));
+
+  input.r[2][0] = Mul(two, Sub(xz, wy));
+  input.r[2][1] = Mul(two, Add(yz, wx));
+  input.r[2][2] = Sub(one, Mul(two, Add(xx, yy)));
+
+  return input;
+}
+
+#if defined(LIGER_TRANSFORM_BATCH_SIMD) && !defined(GLM_FORCE_QUAT_DATA_WXYZ)
+#define LIGER_TRANSFORM_BATCH_FAST_LOAD
+
+static_assert(sizeof(Transform3D) == kInputComponentsCount * sizeof(float));
+static_assert(offsetof(Transform3D, position) == kPositionX * sizeof(float));
+static_assert(offsetof(Transform3D, rotation) == kRotationX * sizeof(float));
+static_assert(offsetof(Transform3D, scale) == kScaleX * sizeof(float));
+
+/* Load 4 consecutive transforms into SoA form by transposing their memory in registers */
+inline void LoadTransposed4(const float* src, __m128 (&components)[kInputComponentsCount]) {
+  constexpr size_t kStride = kInputComponentsCount;
+
+  /* [px py pz qx] */
+  __m128 a0 = _mm_loadu_ps(src + 0U * kStride);
+  __m128 a1 = _mm_loadu_ps(src + 1U * kStride);
+  __m128 a2 = _mm_loadu_ps(src + 2U * kStride);
+  __m128 a3 = _mm_loadu_ps(src + 3U * kStride);
+  _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+  /* [qy qz qw sx] */
+  __m128 b0 = _mm_loadu_ps(src + 0U * kStride + 4U);
+  __m128 b1 = _mm_loadu_ps(src + 1U * kStride + 4U);
+  __m128 b2 = _mm_loadu_ps(src + 2U * kStride + 4U);
+  __m128 b3 = _mm_loadu_ps(src + 3U * kStride + 4U);
+  _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+
+  /* [qw sx sy sz], overlaps the previous load so that it does not read past the transform */
+  __m128 c0 = _mm_loadu_ps(src + 0U * kStride + 6U);
+  __m128 c1 = _mm_loadu_ps(src + 1U * kStride + 6U);
+  __m128 c2 = _mm_loadu_ps(src + 2U * kStride + 6U);
+  __m128 c3 = _mm_loadu_ps(src + 3U * kStride + 6U);
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+  components[kPositionX] = a0;
+  components[kPositionY] = a1;
+  components[kPositionZ] = a2;
+  components[kRotationX] = a3;
+  components[kRotationY] = b0;
+  components[kRotationZ] = b1;
+  components[kRotationW] = b2;
+  components[kScaleX]    = b3;
+  components[kScaleY]    = c2;
+  components[kScaleZ]    = c3;
+}
+#endif
+
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+Input LoadInput(std::span<const Transform3D> transforms, size_t first, size_t count) {
+  alignas(32) float components[kInputComponentsCount][kLaneWidth];
+
+#if defined(LIGER_TRANSFORM_BATCH_FAST_LOAD)
+  if (count == kLaneWidth) {
+    const auto* src = reinterpret_cast<const float*>(transforms.data() + first);
+
+    __m128 low[kInputComponentsCount];
+    LoadTransposed4(src, low);
+#if defined(__AVX2__)
+    __m128 high[kInputComponentsCount];
+    LoadTransposed4(src + 4U * kInputComponentsCount, high);
+#endif
+
+    for (uint32_t component = 0; component < kInputComponentsCount; ++component) {
+#if defined(__AVX2__)
+      Store(components[component], _mm256_set_m128(high[component], low[component]));
+#else
+      Store(components[component], low[component]);
+#endif
+    }
+
+    return PrepareInput(components);
+  }
+#endif
+
+  for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+    if (lane >= count) {
+      for (uint32_t component = 0; component < kInputComponentsCount; ++component) {
+        components[component][lane] = kPaddingValues[component];
+      }
+      continue;
+    }
+
+    const auto& transform = transforms[first + lane];
+
+    components[kPositionX][lane] = transform.position.x;
+    components[kPositionY][lane] = transform.position.y;
+    components[kPositionZ][lane] = transform.position.z;
+    components[kRotationX][lane] = transform.rotation.x;
+    components[kRotationY][lane] = transform.rotation.y;
+    components[kRotationZ][lane] = transform.rotation.z;
+    components[kRotationW][lane] = transform.rotation.w;
+    components[kScaleX][lane]    = transform.scale.x;
+    components[kScaleY][lane]    = transform.scale.y;
+    components[kScaleZ][lane]    = transform.scale.z;
+  }
+
+  return PrepareInput(components);
+}
+#endif
+
+Input LoadInput(const Transform3DSoA& transforms, size_t first, size_t count) {
+  const float* arrays[kInputComponentsCount] = {
+      transforms.position_x, transforms.position_y, transforms.position_z,
+      transforms.rotation_x, transforms.rotation_y, transforms.rotation_z, transforms.rotation_w,
+      transforms.scale_x,    transforms.scale_y,    transforms.scale_z,
+  };
+
+  alignas(32) float components[kInputComponentsCount][kLaneWidth];
+
+  for (uint32_t component = 0; component < kInputComponentsCount; ++component) {
+    std::memcpy(components[component], arrays[component] + first, count * sizeof(float));
+    std::fill(components[component] + count, components[component] + kLaneWidth, kPaddingValues[component]);
+  }
+
+  return PrepareInput(components);
+}
+
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+/* Transpose 4 columns of 4 values (each in SoA form) into 4 matrices directly in registers */
+inline void StoreColumnsTransposed(__m128 row0, __m128 row1, __m128 row2, __m128 row3, std::byte* out,
+                                   size_t out_stride, size_t column) {
+  _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+  const size_t offset = column * 4U * sizeof(float);
+  _mm_storeu_ps(reinterpret_cast<float*>(out + 0U * out_stride + offset), row0);
+  _mm_storeu_ps(reinterpret_cast<float*>(out + 1U * out_stride + offset), row1);
+  _mm_storeu_ps(reinterpret_cast<float*>(out + 2U * out_stride + offset), row2);
+  _mm_storeu_ps(reinterpret_cast<float*>(out + 3U * out_stride + offset), row3);
+}
+
+inline void StoreMatrices4x4(const Lane (&values)[16], std::byte* out, size_t out_stride) {
+  for (size_t column = 0; column < 4U; ++column) {
+    const Lane* rows = values + column * 4U;
+#if defined(__AVX2__)
+    StoreColumnsTransposed(_mm256_castps256_ps128(rows[0]), _mm256_castps256_ps128(rows[1]),
+                           _mm256_castps256_ps128(rows[2]), _mm256_castps256_ps128(rows[3]), out, out_stride,
+                           column);
+    StoreColumnsTransposed(_mm256_extractf128_ps(rows[0], 1), _mm256_extractf128_ps(rows[1], 1),
+                           _mm256_extractf128_ps(rows[2], 1), _mm256_extractf128_ps(rows[3], 1),
+                           out + 4U * out_stride, out_stride, column);
+#else
+    StoreColumnsTransposed(rows[0], rows[1], rows[2], rows[3], out, out_stride, column);
+#endif
+  }
+}
+#endif
+
+template <typename Matrix, size_t kValuesCount>
+void StoreOutput(const Lane (&values)[kValuesCount], Matrix* out, size_t out_stride, size_t first, size_t count) {
+  static_assert(sizeof(Matrix) == kValuesCount * sizeof(float));
+
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+  if constexpr (kValuesCount == 16) {
+    if (count == kLaneWidth) {
+      StoreMatrices4x4(values, reinterpret_cast<std::byte*>(out) + first * out_stride, out_stride);
+      return;
+    }
+  }
+#endif
+
+  alignas(32) float lanes[kValuesCount][kLaneWidth];
+  for (size_t value = 0; value < kValuesCount; ++value) {
+    Store(lanes[value], values[value]);
+  }
+
+  auto* out_bytes = reinterpret_cast<std::byte*>(out);
+  for (size_t lane = 0; lane < count; ++lane) {
+    float matrix[kValuesCount];
+    for (size_t value = 0; value < kValuesCount; ++value) {
+      matrix[value] = lanes[value][lane];
+    }
+
+    std::memcpy(out_bytes + (first + lane) * out_stride, matrix, sizeof(matrix));
+  }
+}
+
+template <typename Transforms, typename Kernel>
+void ForEachBlock(const Transforms& transforms, size_t transforms_count, Kernel&& kernel) {
+  for (size_t first = 0; first < transforms_count; first += kLaneWidth) {
+    const size_t count = std::min(kLaneWidth, transforms_count - first);
+    kernel(LoadInput(transforms, first, count), first, count);
+  }
+}
+
+template <typename Transforms>
+void ComposeMatricesImpl(const Transforms& transforms, size_t transforms_count, glm::mat4* out, size_t out_stride) {
+  ForEachBlock(transforms, transforms_count, [&](const Input& in, size_t first, size_t count) {
+    const Lane zero = Set1(0.0f);
+    const Lane one  = Set1(1.0f);
+
+    /* Column-major: column i is rotation column i scaled by scale[i] */
+    const Lane values[16] = {
+        Mul(in.r[0][0], in.scale[0]), Mul(in.r[1][0], in.scale[0]), Mul(in.r[2][0], in.scale[0]), zero,
+        Mul(in.r[0][1], in.scale[1]), Mul(in.r[1][1], in.scale[1]), Mul(in.r[2][1], in.scale[1]), zero,
+        Mul(in.r[0][2], in.scale[2]), Mul(in.r[1][2], in.scale[2]), Mul(in.r[2][2], in.scale[2]), zero,
+        in.position[0],               in.position[1],               in.position[2],               one,
+    };
+
+    StoreOutput(values, out, out_stride, first, count);
+  });
+}
+
+template <typename Transforms>
+void ComposeInverseMatricesImpl(const Transforms& transforms, size_t transforms_count, glm::mat4* out,
+                                size_t out_stride) {
+  ForEachBlock(transforms, transforms_count, [&](const Input& in, size_t first, size_t count) {
+    const Lane zero = Set1(0.0f);
+    const Lane one  = Set1(1.0f);
+
+    const Lane inv_scale[3] = {Div(one, in.scale[0]), Div(one, in.scale[1]), Div(one, in.scale[2])};
+
+    /* Row i of S^-1 * R^T is column i of R scaled by 1 / scale[i] */
+    Lane linear[3][3];  // linear[row][column]
+    for (uint32_t row = 0; row < 3; ++row) {
+      for (uint32_t column = 0; column < 3; ++column) {
+        linear[row][column] = Mul(in.r[column][row], inv_scale[row]);
+      }
+    }
+
+    Lane translation[3];
+    for (uint32_t row = 0; row < 3; ++row) {
+      translation[row] = Sub(zero, Add(Add(Mul(linear[row][0], in.position[0]), Mul(linear[row][1], in.position[1])),
+                                       Mul(linear[row][2], in.position[2])));
+    }
+
+    const Lane values[16] = {
+        linear[0][0],   linear[1][0],   linear[2][0],   zero,
+        linear[0][1],   linear[1][1],   linear[2][1],   zero,
+        linear[0][2],   linear[1][2],   linear[2][2],   zero,
+        translation[0], translation[1], translation[2], one,
+    };
+
+    StoreOutput(values, out, out_stride, first, count);
+  });
+}
+
+template <typename Transforms>
+void ComposeNormalMatricesImpl(const Transforms& transforms, size_t transforms_count, glm::mat3* out,
+                               size_t out_stride) {
+  ForEachBlock(transforms, transforms_count, [&](const Input& in, size_t first, size_t count) {
+    const Lane values[9] = {
+        Div(in.r[0][0], in.scale[0]), Div(in.r[1][0], in.scale[0]), Div(in.r[2][0], in.scale[0]),
+        Div(in.r[0][1], in.scale[1]), Div(in.r[1][1], in.scale[1]), Div(in.r[2][1], in.scale[1]),
+        Div(in.r[0][2], in.scale[2]), Div(in.r[1][2], in.scale[2]), Div(in.r[2][2], in.scale[2]),
+    };
+
+    StoreOutput(values, out, out_stride, first, count);
+  });
+}
+
+#if !defined(LIGER_TRANSFORM_BATCH_SIMD)
+/* Without SIMD there is nothing to gain from transposing AoS input, so compose each transform directly */
+template <typename Matrix, typename F>
+void ComposeScalar(std::span<const Transform3D> transforms, Matrix* out, size_t out_stride, F&& compose) {
+  auto* out_bytes = reinterpret_cast<std::byte*>(out);
+  for (const auto& transform : transforms) {
+    const Matrix matrix = compose(transform);
+    std::memcpy(out_bytes, &matrix, sizeof(Matrix));
+    out_bytes += out_stride;
+  }
+}
+#endif
+
+}  // namespace
+
+void ComposeMatrices(std::span<const Transform3D> transforms, glm::mat4* out, size_t out_stride) {
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+  ComposeMatricesImpl(transforms, transforms.size(), out, out_stride);
+#else
+  ComposeScalar(transforms, out, out_stride, [](const Transform3D& transform) { return transform.Matrix(); });
+#endif
+}
+
+void ComposeMatrices(const Transform3DSoA& transforms, glm::mat4* out, size_t out_stride) {
+  ComposeMatricesImpl(transforms, transforms.count, out, out_stride);
+}
+
+void ComposeInverseMatrices(std::span<const Transform3D> transforms, glm::mat4* out, size_t out_stride) {
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+  ComposeInverseMatricesImpl(transforms, transforms.size(), out, out_stride);
+#else
+  ComposeScalar(transforms, out, out_stride, [](const Transform3D& transform) { return transform.InverseMatrix(); });
+#endif
+}
+
+void ComposeInverseMatrices(const Transform3DSoA& transforms, glm::mat4* out, size_t out_stride) {
+  ComposeInverseMatricesImpl(transforms, transforms.count, out, out_stride);
+}
+
+void ComposeNormalMatrices(std::span<const Transform3D> transforms, glm::mat3* out, size_t out_stride) {
+#if defined(LIGER_TRANSFORM_BATCH_SIMD)
+  ComposeNormalMatricesImpl(transforms, transforms.size(), out, out_stride);
+#else
+  ComposeScalar(transforms, out, out_stride, [](const Transform3D& transform) { return transform.NormalMatrix(); });
+#endif
+}
+
+void ComposeNormalMatrices(const Transform3DSoA& transforms, glm::mat3* out, size_t out_stride) {
+  ComposeNormalMatricesImpl(transforms, transforms.count, out, out_stride);
+}
+
+}  // namespace liger::transform_batch
@@ -0,0 +1,292 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file AllocationTracker.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Memory/AllocationTracker.hpp>
+
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif
+
+namespace liger {
+
+#if defined(LIGER_TRACK_ALLOCATIONS)
+
+namespace {
+
+/* RecordAllocation, Allocate/AllocateAligned and operator new */
+constexpr int kSkippedFrames = 3;
+
+struct TrackerState {
+  std::atomic<bool>     tracking{false};
+  std::atomic<uint64_t> allocations{0U};
+  std::atomic<uint64_t> bytes{0U};
+
+  std::atomic_flag      call_sites_lock = ATOMIC_FLAG_INIT;
+  uint32_t              call_site_count{0U};
+  uint64_t              untracked_call_site_allocations{0U};
+
+  std::array<AllocationTracker::CallSite, AllocationTracker::kMaxCallSites> call_sites;
+};
+
+/* Constant initialized, so that it is usable by allocations made during static initialization */
+constinit TrackerState g_state;
+
+/* Prevents tracking allocations made by the tracker itself, e.g. by backtrace() */
+thread_local bool t_inside_tracker = false;
+
+[[gnu::noinline]] void RecordAllocation(size_t size) {
+  if (!g_state.tracking.load(std::memory_order_relaxed) || t_inside_tracker) {
+    return;
+  }
+
+  t_inside_tracker = true;
+
+  g_state.allocations.fetch_add(1U, std::memory_order_relaxed);
+  g_state.bytes.fetch_add(size, std::memory_order_relaxed);
+
+  AllocationTracker::CallSite site;
+
+#if defined(__GLIBC__)
+  std::array<void*, AllocationTracker::kMaxStackDepth + kSkippedFrames> frames;
+  const int captured = backtrace(frames.data(), static_cast<int>(frames.size()));
+
+  site.depth = static_cast<uint32_t>(std::max(captured - kSkippedFrames, 0));
+  std::copy_n(frames.begin() + kSkippedFrames, site.depth, site.stack.begin());
+#endif
+
+  while (g_state.call_sites_lock.test_and_set(std::memory_order_acquire)) {}
+
+  auto* sites_end = g_state.call_sites.begin() + g_state.call_site_count;
+  auto* found     = std::find_if(g_state.call_sites.begin(), sites_end, [&site](const auto& other) {
+    return other.depth == site.depth && std::equal(site.stack.begin(), site.stack.begin() + site.depth, other.stack.begin());
+  });
+
+  if (found == sites_end && g_state.call_site_count < AllocationTracker::kMaxCallSites) {
+    *found = site;
+    ++g_state.call_site_count;
+  }
+
+  if (found != g_state.call_sites.end()) {
+    ++found->allocations;
+    found->bytes += size;
+  } else {
+    ++g_state.untracked_call_site_allocations;
+  }
+
+  g_state.call_sites_lock.clear(std::memory_order_release);
+
+  t_inside_tracker = false;
+}
+
+[[gnu::noinline]] void* Allocate(size_t size) {
+  RecordAllocation(size);
+
+  if (void* ptr = std::malloc(size != 0U ? size : 1U)) {
+    return ptr;
+  }
+
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void* AllocateAligned(size_t size, std::align_val_t alignment) {
+  RecordAllocation(size);
+
+  const auto align = static_cast<size_t>(alignment);
+
+#if defined(_MSC_VER)
+  void* ptr = _aligned_malloc(size != 0U ? size : 1U, align);
+#else
+  void* ptr = std::aligned_alloc(align, std::max((size + align - 1U) & ~(align - 1U), align));
+#endif
+
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void FreeAligned(void* ptr) {
+#if defined(_MSC_VER)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+}  // namespace
+
+bool AllocationTracker::Available() { return true; }
+
+void AllocationTracker::Start() {
+  while (g_state.call_sites_lock.test_and_set(std::memory_order_acquire)) {}
+  g_state.call_site_count                 = 0U;
+  g_state.untracked_call_site_allocations = 0U;
+  g_state.call_sites_lock.clear(std::memory_order_release);
+
+  g_state.allocations.store(0U, std::memory_order_relaxed);
+  g_state.bytes.store(0U, std::memory_order_relaxed);
+  g_state.tracking.store(true, std::memory_order_release);
+}
+
+AllocationTracker::Report AllocationTracker::Stop() {
+  g_state.tracking.store(false, std::memory_order_release);
+
+  Report report;
+
+  while (g_state.call_sites_lock.test_and_set(std::memory_order_acquire)) {}
+  report.allocations                     = g_state.allocations.load(std::memory_order_relaxed);
+  report.bytes                           = g_state.bytes.load(std::memory_order_relaxed);
+  report.untracked_call_site_allocations = g_state.untracked_call_site_allocations;
+
+  std::array<CallSite, kMaxCallSites> call_sites = g_state.call_sites;
+  const uint32_t                      count      = g_state.call_site_count;
+  g_state.call_sites_lock.clear(std::memory_order_release);
+
+  report.call_sites.assign(call_sites.begin(), call_sites.begin() + count);
+  std::sort(report.call_sites.begin(), report.call_sites.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.allocations > rhs.allocations; });
+
+  return report;
+}
+
+#else
+
+bool AllocationTracker::Available() { return false; }
+
+void AllocationTracker::Start() {}
+
+AllocationTracker::Report AllocationTracker::Stop() { return Report{}; }
+
+#endif
+
+void AllocationTracker::LogReport(const Report& report, const char* channel) {
+  if (!Available()) {
+    LIGER_LOG_WARN(channel, "Allocation tracking is unavailable, build with LIGER_TRACK_ALLOCATIONS");
+    return;
+  }
+
+  LIGER_LOG_INFO(channel, "{} allocations, {} bytes, {} call sites", report.allocations, report.bytes,
+                 report.call_sites.size());
+
+  if (report.untracked_call_site_allocations > 0U) {
+    LIGER_LOG_WARN(channel, "{} allocations from call sites exceeding the limit of {}",
+                   report.untracked_call_site_allocations, kMaxCallSites);
+  }
+
+  for (const auto& site : report.call_sites) {
+    LIGER_LOG_INFO(channel, "Call site: {} allocations, {} bytes", site.allocations, site.bytes);
+
+#if defined(__GLIBC__)
+    char** symbols = backtrace_symbols(site.stack.data(), static_cast<int>(site.depth));
+    for (uint32_t frame = 0U; frame < site.depth; ++frame) {
+      LIGER_LOG_INFO(channel, "    #{} {}", frame, symbols != nullptr ? symbols[frame] : "?");
+    }
+    std::free(symbols);
+#else
+    for (uint32_t frame = 0U; frame < site.depth; ++frame) {
+      LIGER_LOG_INFO(channel, "    #{} {}", frame, site.stack[frame]);
+    }
+#endif
+  }
+}
+
+bool AllocationTracker::CheckSteadyState(uint32_t warmup_frames, uint32_t measured_frames,
+                                         const std::function<void()>& run_frame) {
+  if (!Available()) {
+    LIGER_LOG_WARN(kLogChannelCore, "Allocation tracking is unavailable, steady state check skipped");
+    return true;
+  }
+
+  for (uint32_t frame = 0U; frame < warmup_frames; ++frame) {
+    run_frame();
+  }
+
+  Start();
+  for (uint32_t frame = 0U; frame < measured_frames; ++frame) {
+    run_frame();
+  }
+  const auto report = Stop();
+
+  if (report.allocations == 0U) {
+    LIGER_LOG_INFO(kLogChannelCore, "No allocations in {} steady state frames", measured_frames);
+    return true;
+  }
+
+  LIGER_LOG_ERROR(kLogChannelCore, "Steady state frames allocated memory ({} frames measured after {} warm-up frames)",
+                  measured_frames, warmup_frames);
+  LogReport(report, kLogChannelCore);
+
+  return false;
+}
+
+}  // namespace liger
+
+#if defined(LIGER_TRACK_ALLOCATIONS)
+
+void* operator new(size_t size) { return liger::Allocate(size); }
+void* operator new[](size_t size) { return liger::Allocate(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return liger::Allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return liger::Allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new(size_t size, std::align_val_t alignment) { return liger::AllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return liger::AllocateAligned(size, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { liger::FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { liger::FreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { liger::FreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { liger::FreeAligned(ptr); }
+
+#endif
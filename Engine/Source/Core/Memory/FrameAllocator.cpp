@@ -0,0 +1,61 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FrameAllocator.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Memory/FrameAllocator.hpp>
+
+#include <atomic>
+
+namespace liger {
+
+namespace {
+
+std::atomic<uint64_t> g_frame_epoch{1U};
+
+}  // namespace
+
+void FrameArena::BeginFrame() {
+  g_frame_epoch.fetch_add(1U, std::memory_order_release);
+}
+
+LinearArena& FrameArena::Get() {
+  thread_local LinearArena arena;
+  thread_local uint64_t    arena_epoch{0U};
+
+  const uint64_t epoch = g_frame_epoch.load(std::memory_order_acquire);
+  if (arena_epoch != epoch) {
+    arena.Reset();
+    arena_epoch = epoch;
+  }
+
+  return arena;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+  return Get().Allocate(size, alignment);
+}
+
+}  // namespace liger
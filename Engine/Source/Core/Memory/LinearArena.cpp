@@ -0,0 +1,103 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file LinearArena.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Memory/LinearArena.hpp>
+
+#include <algorithm>
+#include <new>
+
+namespace liger {
+
+LinearArena::LinearArena(size_t block_size) : block_size_(block_size) {}
+
+LinearArena::~LinearArena() {
+  ReleaseBlocks();
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment) {
+  auto aligned = [alignment](std::byte* ptr) {
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    return reinterpret_cast<std::byte*>((address + alignment - 1U) & ~(alignment - 1U));
+  };
+
+  std::byte* result = (current_ != nullptr) ? aligned(cursor_) : nullptr;
+  if (result == nullptr || result > end_ || static_cast<size_t>(end_ - result) < size) {
+    PushBlock(size + alignment);
+    result = aligned(cursor_);
+  }
+
+  used_   += static_cast<size_t>(result + size - cursor_);
+  cursor_  = result + size;
+
+  return result;
+}
+
+void LinearArena::Reset() {
+  if (current_ != nullptr && current_->prev != nullptr) {
+    /* Coalesce the chain, so that the same workload fits into a single block next time */
+    const size_t total_size = capacity_;
+    ReleaseBlocks();
+    PushBlock(total_size);
+  }
+
+  if (current_ != nullptr) {
+    cursor_ = current_->Begin();
+    end_    = current_->End();
+  }
+
+  used_ = 0U;
+}
+
+size_t LinearArena::Used() const { return used_; }
+size_t LinearArena::Capacity() const { return capacity_; }
+
+void LinearArena::PushBlock(size_t min_size) {
+  const size_t size = std::max(block_size_, min_size);
+
+  auto* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+  block->prev = current_;
+  block->size = size;
+
+  current_   = block;
+  cursor_    = block->Begin();
+  end_       = block->End();
+  capacity_ += size;
+}
+
+void LinearArena::ReleaseBlocks() {
+  while (current_ != nullptr) {
+    Block* prev = current_->prev;
+    ::operator delete(current_);
+    current_ = prev;
+  }
+
+  cursor_   = nullptr;
+  end_      = nullptr;
+  capacity_ = 0U;
+}
+
+}  // namespace liger
@@ -0,0 +1,233 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file InputRecording.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Platform/InputRecording.hpp>
+
+#include <Liger-Engine/Core/LogChannel.hpp>
+#include <Liger-Engine/Core/Platform/PlatformLayer.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace liger {
+
+namespace {
+
+constexpr uint32_t kRecordingMagic   = 0x4352494CU;  // "LIRC"
+constexpr uint32_t kRecordingVersion = 1U;
+
+enum class InputEventType : uint8_t {
+  Key,
+  MouseMove,
+  MouseButton,
+  MouseScroll,
+};
+
+}  // namespace
+
+/************************************************************************************************
+ * Recorder
+ ************************************************************************************************/
+template <typename T>
+void InputRecorder::Write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  const auto offset = data_.size();
+  data_.resize(offset + sizeof(T));
+  std::memcpy(data_.data() + offset, &value, sizeof(T));
+}
+
+template <typename EventT>
+void InputRecorder::RecordEvent(uint8_t type, const EventT& event) {
+  if (frame_count_ == 0U) {
+    return;
+  }
+
+  Write(type);
+  Write(event);
+
+  uint32_t event_count = 0U;
+  std::memcpy(&event_count, data_.data() + event_count_offset_, sizeof(event_count));
+  ++event_count;
+  std::memcpy(data_.data() + event_count_offset_, &event_count, sizeof(event_count));
+}
+
+void InputRecorder::BeginFrame(float delta_time) {
+  Write(delta_time);
+
+  event_count_offset_ = data_.size();
+  Write(uint32_t{0U});
+
+  ++frame_count_;
+}
+
+void InputRecorder::Record(const KeyEvent& event) {
+  RecordEvent(static_cast<uint8_t>(InputEventType::Key), event);
+}
+
+void InputRecorder::Record(const MouseMoveEvent& event) {
+  RecordEvent(static_cast<uint8_t>(InputEventType::MouseMove), event);
+}
+
+void InputRecorder::Record(const MouseButtonEvent& event) {
+  RecordEvent(static_cast<uint8_t>(InputEventType::MouseButton), event);
+}
+
+void InputRecorder::Record(const MouseScrollEvent& event) {
+  RecordEvent(static_cast<uint8_t>(InputEventType::MouseScroll), event);
+}
+
+uint32_t InputRecorder::FrameCount() const { return frame_count_; }
+
+bool InputRecorder::Save(const std::filesystem::path& filepath) const {
+  std::ofstream file(filepath, std::ios::binary);
+  if (!file.is_open()) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to open file '{}' for saving input recording", filepath.string());
+    return false;
+  }
+
+  const uint32_t header[] = {kRecordingMagic, kRecordingVersion, frame_count_};
+  file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+
+  return file.good();
+}
+
+/************************************************************************************************
+ * Replayer
+ ************************************************************************************************/
+template <typename T>
+bool InputReplayer::Read(T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  if (cursor_ + sizeof(T) > data_.size()) {
+    return false;
+  }
+
+  std::memcpy(&value, data_.data() + cursor_, sizeof(T));
+  cursor_ += sizeof(T);
+
+  return true;
+}
+
+bool InputReplayer::Load(const std::filesystem::path& filepath) {
+  std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to open input recording '{}'", filepath.string());
+    return false;
+  }
+
+  data_.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+
+  cursor_        = 0U;
+  current_frame_ = 0U;
+  frame_count_   = 0U;
+
+  uint32_t magic   = 0U;
+  uint32_t version = 0U;
+  if (!file.good() || !Read(magic) || !Read(version) || !Read(frame_count_) || magic != kRecordingMagic ||
+      version != kRecordingVersion) {
+    LIGER_LOG_ERROR(kLogChannelCore, "File '{}' is not a valid input recording", filepath.string());
+    data_.clear();
+    frame_count_ = 0U;
+    return false;
+  }
+
+  return true;
+}
+
+void InputReplayer::SetFixedTimestep(std::optional<float> timestep) { fixed_timestep_ = timestep; }
+
+template <typename EventCallback>
+float InputReplayer::ReplayFrame(EventCallback&& callback) {
+  if (Finished()) {
+    return fixed_timestep_.value_or(0.0f);
+  }
+
+  float    delta_time  = 0.0f;
+  uint32_t event_count = 0U;
+  bool     valid       = Read(delta_time) && Read(event_count);
+
+  auto replay = [this, &callback]<typename EventT>(EventT event) {
+    if (!Read(event)) {
+      return false;
+    }
+
+    callback(event);
+    return true;
+  };
+
+  for (uint32_t event_idx = 0U; valid && event_idx < event_count; ++event_idx) {
+    uint8_t type = 0U;
+    if (!Read(type)) {
+      valid = false;
+      break;
+    }
+
+    switch (static_cast<InputEventType>(type)) {
+      case InputEventType::Key:         { valid = replay(KeyEvent{});         break; }
+      case InputEventType::MouseMove:   { valid = replay(MouseMoveEvent{});   break; }
+      case InputEventType::MouseButton: { valid = replay(MouseButtonEvent{}); break; }
+      case InputEventType::MouseScroll: { valid = replay(MouseScrollEvent{}); break; }
+
+      default: { valid = false; }
+    }
+  }
+
+  if (!valid) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Input recording is corrupted at frame {}, stopping replay", current_frame_);
+    current_frame_ = frame_count_;
+    return fixed_timestep_.value_or(0.0f);
+  }
+
+  ++current_frame_;
+
+  return fixed_timestep_.value_or(delta_time);
+}
+
+float InputReplayer::NextFrame(PlatformLayer& platform) {
+  return ReplayFrame([&platform]<typename EventT>(const EventT& event) {
+    if constexpr (std::is_same_v<EventT, KeyEvent>) {
+      platform.SetReplayedKeyState(event.key, event.action != PressAction::Release);
+    }
+
+    platform.Enqueue(event);
+  });
+}
+
+float InputReplayer::NextFrame(EventDispatcher& dispatcher) {
+  return ReplayFrame([&dispatcher](const auto& event) { dispatcher.Enqueue(event); });
+}
+
+bool InputReplayer::Finished() const { return current_frame_ >= frame_count_; }
+
+uint32_t InputReplayer::FrameCount() const { return frame_count_; }
+uint32_t InputReplayer::CurrentFrame() const { return current_frame_; }
+
+}  // namespace liger
@@ -0,0 +1,181 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file MappedFile.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Platform/MappedFile.hpp>
+
+#include <Liger-Engine/Core/Log/Log.hpp>
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace liger {
+
+MappedFile::~MappedFile() { Close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0U))
+#if defined(_WIN32)
+      ,
+      file_(std::exchange(other.file_, nullptr)),
+      mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Close();
+
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0U);
+#if defined(_WIN32)
+    file_    = std::exchange(other.file_, nullptr);
+    mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+  }
+
+  return *this;
+}
+
+#if defined(_WIN32)
+bool MappedFile::Open(const std::filesystem::path& filepath) {
+  Close();
+
+  HANDLE file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to open file '{0}'", filepath.string());
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to map file '{0}', it is empty or its size is unknown", filepath.string());
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  if (data == nullptr) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to map file '{0}'", filepath.string());
+    if (mapping) {
+      CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    return false;
+  }
+
+  data_    = static_cast<const std::byte*>(data);
+  size_    = static_cast<size_t>(size.QuadPart);
+  file_    = file;
+  mapping_ = mapping;
+
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data_ != nullptr) {
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_);
+    CloseHandle(file_);
+  }
+
+  data_    = nullptr;
+  size_    = 0U;
+  file_    = nullptr;
+  mapping_ = nullptr;
+}
+#else
+bool MappedFile::Open(const std::filesystem::path& filepath) {
+  Close();
+
+  const int fd = open(filepath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to open file '{0}'", filepath.string());
+    return false;
+  }
+
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to map file '{0}', it is empty or its size is unknown", filepath.string());
+    close(fd);
+    return false;
+  }
+
+  int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+  /* The file is read as a whole right away, so fault all pages in at once */
+  flags |= MAP_POPULATE;
+#endif
+
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  void*      data = mmap(nullptr, size, PROT_READ, flags, fd, 0);
+
+  /* The mapping keeps the file referenced */
+  close(fd);
+
+  if (data == MAP_FAILED) {
+    LIGER_LOG_ERROR(kLogChannelCore, "Failed to map file '{0}'", filepath.string());
+    return false;
+  }
+
+  madvise(data, size, MADV_SEQUENTIAL);
+
+  data_ = static_cast<const std::byte*>(data);
+  size_ = size;
+
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data_ != nullptr) {
+    munmap(const_cast<std::byte*>(data_), size_);
+  }
+
+  data_ = nullptr;
+  size_ = 0U;
+}
+#endif
+
+bool MappedFile::Valid() const { return data_ != nullptr; }
+
+std::span<const std::byte> MappedFile::Data() const { return {data_, size_}; }
+
+}  // namespace liger
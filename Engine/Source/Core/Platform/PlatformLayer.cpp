@@ -27,6 +27,8 @@
 
 #include <Liger-Engine/Core/Platform/PlatformLayer.hpp>
 
+#include <Liger-Engine/Core/Platform/InputRecording.hpp>
+
 namespace liger {
 
 PlatformLayer PlatformLayer::instance_;
@@ -46,6 +48,7 @@ PlatformLayer::~PlatformLayer() {
 
 void PlatformLayer::PollEvents() {
   glfwPollEvents();
+  dispatcher_.DispatchQueued();
 }
 
 /************************************************************************************************
@@ -87,7 +90,7 @@ void PlatformLayer::WindowCloseCallback(GLFWwindow* glfw_window) {
   WindowCloseEvent event{};
   event.window = platform->window_wrapper_[glfw_window];
 
-  platform->dispatcher_.Dispatch(event);
+  platform->dispatcher_.Enqueue(event);
 }
 
 void PlatformLayer::KeyCallback(GLFWwindow* glfw_window, int32_t key, int32_t /*scancode*/, int32_t action,
@@ -100,7 +103,7 @@ void PlatformLayer::KeyCallback(GLFWwindow* glfw_window, int32_t key, int32_t /*
   event.action = static_cast<PressAction>(action);
   event.mods   = static_cast<KeyMods>(mods);
 
-  platform->dispatcher_.Dispatch(event);
+  platform->PushInputEvent(event);
 }
 
 void PlatformLayer::ScrollCallback(GLFWwindow* glfw_window, double dx, double dy) {
@@ -110,7 +113,7 @@ void PlatformLayer::ScrollCallback(GLFWwindow* glfw_window, double dx, double dy
   MouseScrollEvent event{};
   event.delta = glm::vec2{dx, dy};
 
-  platform->dispatcher_.Dispatch(event);
+  platform->PushInputEvent(event);
 }
 
 void PlatformLayer::MouseMoveCallback(GLFWwindow* glfw_window, double x, double y) {
@@ -123,7 +126,7 @@ void PlatformLayer::MouseMoveCallback(GLFWwindow* glfw_window, double x, double
 
   platform->prev_mouse_pos_[glfw_window] = event.new_position;
 
-  platform->dispatcher_.Dispatch(event);
+  platform->PushInputEvent(event);
 }
 
 void PlatformLayer::MouseButtonCallback(GLFWwindow* glfw_window, int32_t button, int32_t action, int32_t mods) {
@@ -138,7 +141,20 @@ void PlatformLayer::MouseButtonCallback(GLFWwindow* glfw_window, int32_t button,
   event.action            = static_cast<PressAction>(action);
   event.mods              = static_cast<KeyMods>(mods);
 
-  platform->dispatcher_.Dispatch(event);
+  platform->PushInputEvent(event);
+}
+
+template <typename EventT>
+void PlatformLayer::PushInputEvent(const EventT& event) {
+  if (replay_) {
+    return;
+  }
+
+  if (recorder_ != nullptr) {
+    recorder_->Record(event);
+  }
+
+  dispatcher_.Enqueue(event);
 }
 
 /************************************************************************************************
@@ -147,6 +163,11 @@ void PlatformLayer::MouseButtonCallback(GLFWwindow* glfw_window, int32_t button,
 bool PlatformLayer::KeyPressed(Window* window, Key key) const {
   LIGER_ASSERT(window, "PlatformLayer", "Invalid window!");
 
+  if (replay_) {
+    const auto key_idx = static_cast<size_t>(key);
+    return key_idx < replayed_keys_.size() && replayed_keys_[key_idx];
+  }
+
   auto action = glfwGetKey(window->GetGLFWwindow(), static_cast<int32_t>(key));
   return action == GLFW_PRESS || action == GLFW_REPEAT;
 }
@@ -166,4 +187,20 @@ void PlatformLayer::SetCursorEnabled(Window* window, bool enabled) {
   glfwSetInputMode(window->GetGLFWwindow(), GLFW_CURSOR, enabled ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
 }
 
+void PlatformLayer::SetInputRecorder(InputRecorder* recorder) { recorder_ = recorder; }
+
+void PlatformLayer::SetInputReplay(bool enabled) {
+  replay_ = enabled;
+  replayed_keys_.reset();
+}
+
+bool PlatformLayer::InputReplay() const { return replay_; }
+
+void PlatformLayer::SetReplayedKeyState(Key key, bool pressed) {
+  const auto key_idx = static_cast<size_t>(key);
+  if (key_idx < replayed_keys_.size()) {
+    replayed_keys_[key_idx] = pressed;
+  }
+}
+
 }  // namespace liger
\ No newline at end of file
@@ -0,0 +1,175 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file FrameTaskGraph.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/Task/FrameTaskGraph.hpp>
+
+#include <Liger-Engine/Core/Log/Log.hpp>
+#include <Liger-Engine/Core/LogChannel.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace liger {
+
+FrameTaskGraph::FrameTaskGraph(std::string name) : name_(std::move(name)) {}
+
+FrameTaskGraph::TaskId FrameTaskGraph::Emplace(std::string name, TaskWork work, TaskPriority priority) {
+  tasks_.emplace_back(Task{.name = std::move(name), .work = std::move(work), .priority = priority});
+  dirty_ = true;
+
+  return dag_.DeclareNode();
+}
+
+FrameTaskGraph::TaskId FrameTaskGraph::Compose(std::string name, tf::Taskflow& taskflow, TaskPriority priority) {
+  return Emplace(std::move(name), [this, &taskflow]() { executor_->corun(taskflow); }, priority);
+}
+
+FrameTaskGraph::TaskId FrameTaskGraph::Marker(std::string name) {
+  return Emplace(std::move(name), TaskWork{});
+}
+
+void FrameTaskGraph::Precede(TaskId before, TaskId after) {
+  dag_.AddEdge(before, after);
+  dirty_ = true;
+}
+
+void FrameTaskGraph::Run(tf::Executor& executor) {
+  if (dirty_) {
+    Build();
+  }
+
+  executor_ = &executor;
+  run_timer_.Reset();
+
+  if (executor.this_worker_id() >= 0) {
+    executor.corun(taskflow_);
+  } else {
+    executor.run(taskflow_).wait();
+  }
+}
+
+size_t FrameTaskGraph::Size() const { return tasks_.size(); }
+
+std::string_view FrameTaskGraph::TaskName(TaskId task) const { return tasks_[task].name; }
+
+const FrameTaskGraph::TaskTiming& FrameTaskGraph::LastTiming(TaskId task) const { return timings_[task]; }
+
+std::vector<FrameTaskGraph::TaskId> FrameTaskGraph::CriticalPath() const {
+  DAG<void>::SortedList sorted;
+  if (tasks_.empty() || timings_.size() != tasks_.size() || !dag_.TopologicalSort(sorted)) {
+    return {};
+  }
+
+  constexpr TaskId kNoTask = std::numeric_limits<TaskId>::max();
+
+  /* Longest path in a DAG: relax the successors in topological order */
+  std::vector<float>  start_ms(tasks_.size(), 0.0f);
+  std::vector<float>  finish_ms(tasks_.size(), 0.0f);
+  std::vector<TaskId> prev(tasks_.size(), kNoTask);
+
+  for (auto task : sorted) {
+    finish_ms[task] = start_ms[task] + timings_[task].duration_ms;
+
+    for (auto successor : dag_.GetAdjacencyList(task)) {
+      if (finish_ms[task] > start_ms[successor]) {
+        start_ms[successor] = finish_ms[task];
+        prev[successor]     = task;
+      }
+    }
+  }
+
+  auto last = static_cast<TaskId>(std::max_element(finish_ms.begin(), finish_ms.end()) - finish_ms.begin());
+
+  std::vector<TaskId> path;
+  for (auto task = last; task != kNoTask; task = prev[task]) {
+    path.push_back(task);
+  }
+
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+void FrameTaskGraph::DumpGraphviz(std::ostream& os) {
+  if (dirty_) {
+    Build();
+  }
+
+  taskflow_.dump(os);
+}
+
+void FrameTaskGraph::Build() {
+  DAG<void>::SortedList sorted;
+  LIGER_ASSERT(dag_.TopologicalSort(sorted), kLogChannelCore, "Frame task graph '{0}' has a cycle", name_);
+
+  taskflow_.clear();
+  taskflow_.name(name_);
+  timings_.assign(tasks_.size(), TaskTiming{});
+
+  auto by_priority = [this](TaskId lhs, TaskId rhs) { return tasks_[lhs].priority < tasks_[rhs].priority; };
+
+  /* Tasks without dependencies are scheduled by priority, then in the emplacement order */
+  std::vector<TaskId> order(tasks_.size());
+  for (TaskId task = 0U; task < order.size(); ++task) {
+    order[task] = task;
+  }
+  std::stable_sort(order.begin(), order.end(), by_priority);
+
+  std::vector<tf::Task> tf_tasks(tasks_.size());
+  for (auto task : order) {
+    tf_tasks[task] = taskflow_.emplace([this, task]() {
+      auto& timing = timings_[task];
+
+      timing.begin_ms = run_timer_.ElapsedMs();
+      timing.worker   = executor_->this_worker_id();
+
+      if (tasks_[task].work) {
+        tasks_[task].work();
+      }
+
+      timing.duration_ms = run_timer_.ElapsedMs() - timing.begin_ms;
+    });
+
+    tf_tasks[task].name(tasks_[task].name);
+  }
+
+  /* Ready successors are scheduled by priority, then in the order they have been added */
+  std::vector<TaskId> successors;
+  for (TaskId task = 0U; task < tasks_.size(); ++task) {
+    const auto& adj_list = dag_.GetAdjacencyList(task);
+
+    successors.assign(adj_list.begin(), adj_list.end());
+    std::stable_sort(successors.begin(), successors.end(), by_priority);
+
+    for (auto successor : successors) {
+      tf_tasks[task].precede(tf_tasks[successor]);
+    }
+  }
+
+  dirty_ = false;
+}
+
+}  // namespace liger
@@ -28,6 +28,9 @@
 #include <Liger-Engine/Core/Log/Log.hpp>
 #include <Liger-Engine/Core/Time.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace liger {
 
 Timer::Timer() { Reset(); }
@@ -48,6 +51,11 @@ ScopedTimer::~ScopedTimer() {
   LIGER_LOG_TRACE(channel_, "{} - {:.{}f}ms", message_, timer_.ElapsedMs(), 3);
 }
 
+FrameTimer::FrameTimer(uint32_t window_size) : window_size_(std::max(window_size, 1U)) {
+  frame_times_ms_.reserve(window_size_);
+  sorted_frame_times_ms_.reserve(window_size_);
+}
+
 float FrameTimer::AbsoluteTime()   const { return absolute_time_; }
 float FrameTimer::AbsoluteTimeMs() const { return absolute_time_ * 1e3f; }
 
@@ -75,7 +83,115 @@ void FrameTimer::BeginFrame() {
   delta_time_    = new_time - absolute_time_;
   absolute_time_ = new_time;
 
+  EndFrame();
+
   ++frame_number_;
 }
 
+void FrameTimer::BeginPhase(FramePhase phase) {
+  phase_begin_[static_cast<uint32_t>(phase)] = timer_.ElapsedMs();
+}
+
+void FrameTimer::EndPhase(FramePhase phase) {
+  const auto idx = static_cast<uint32_t>(phase);
+  current_phase_times_ms_[idx] += timer_.ElapsedMs() - phase_begin_[idx];
+}
+
+float FrameTimer::PhaseTimeMs(FramePhase phase) const {
+  return last_phase_times_ms_[static_cast<uint32_t>(phase)];
+}
+
+FrameTimer::Statistics FrameTimer::CalculateStatistics() const {
+  Statistics statistics;
+
+  statistics.frame_count = static_cast<uint32_t>(frame_times_ms_.size());
+  if (statistics.frame_count == 0U) {
+    return statistics;
+  }
+
+  statistics.p50_ms = Percentile(50.0f);
+  statistics.p95_ms = Percentile(95.0f);
+  statistics.p99_ms = Percentile(99.0f);
+  statistics.max_ms = sorted_frame_times_ms_.back();
+
+  float sum = 0.0f;
+  for (float frame_time_ms : frame_times_ms_) {
+    sum += frame_time_ms;
+  }
+  statistics.mean_ms = sum / static_cast<float>(statistics.frame_count);
+
+  return statistics;
+}
+
+void FrameTimer::SetHitchThresholds(const HitchThresholds& thresholds) { hitch_thresholds_ = thresholds; }
+const FrameTimer::HitchThresholds& FrameTimer::GetHitchThresholds() const { return hitch_thresholds_; }
+
+void FrameTimer::SetCaptureHook(CaptureHook hook) { capture_hook_ = std::move(hook); }
+
+EventSink<FrameHitchEvent>& FrameTimer::GetHitchSink() { return hitch_sink_; }
+
+void FrameTimer::EndFrame() {
+  const float frame_time_ms = delta_time_ * 1e3f;
+
+  if (frame_times_ms_.size() < window_size_) {
+    frame_times_ms_.push_back(frame_time_ms);
+  } else {
+    frame_times_ms_[frame_times_next_] = frame_time_ms;
+  }
+  frame_times_next_ = (frame_times_next_ + 1U) % window_size_;
+  sorted_dirty_     = true;
+
+  last_phase_times_ms_ = current_phase_times_ms_;
+  current_phase_times_ms_.fill(0.0f);
+
+  bool  hitch          = (hitch_thresholds_.absolute_ms > 0.0f && frame_time_ms > hitch_thresholds_.absolute_ms);
+  float median_time_ms = 0.0f;
+
+  if (frame_times_ms_.size() >= kMinFramesForMedian) {
+    median_time_ms = Percentile(50.0f);
+    hitch = hitch || (hitch_thresholds_.relative_to_median > 0.0f &&
+                      frame_time_ms > hitch_thresholds_.relative_to_median * median_time_ms);
+  }
+
+  if (!hitch) {
+    return;
+  }
+
+  const FrameHitchEvent event {
+    .frame_number         = frame_number_,
+    .frame_time_ms        = frame_time_ms,
+    .median_frame_time_ms = median_time_ms,
+    .phase_times_ms       = last_phase_times_ms_
+  };
+
+  if (capture_hook_) {
+    capture_hook_(event);
+  }
+
+  hitch_sink_.Dispatch(event, /*dispatch_to_all=*/true);
+}
+
+float FrameTimer::Percentile(float percent) const {
+  if (sorted_dirty_) {
+    sorted_frame_times_ms_.assign(frame_times_ms_.begin(), frame_times_ms_.end());
+    std::sort(sorted_frame_times_ms_.begin(), sorted_frame_times_ms_.end());
+    sorted_dirty_ = false;
+  }
+
+  /* Nearest-rank method */
+  const auto count = static_cast<float>(sorted_frame_times_ms_.size());
+  const auto rank  = static_cast<size_t>(std::ceil(percent * 0.01f * count));
+
+  return sorted_frame_times_ms_[std::clamp<size_t>(rank, 1U, sorted_frame_times_ms_.size()) - 1U];
+}
+
+ScopedFramePhase::ScopedFramePhase(FrameTimer& frame_timer, FramePhase phase)
+    : frame_timer_(frame_timer), phase_(phase) {
+  frame_timer_.BeginPhase(phase_);
+}
+
+ScopedFramePhase::~ScopedFramePhase() {
+  frame_timer_.EndPhase(phase_);
+}
+
 }  // namespace liger
\ No newline at end of file
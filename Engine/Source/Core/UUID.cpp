@@ -0,0 +1,74 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file UUID.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/Core/UUID.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+
+namespace liger::detail {
+
+namespace {
+
+uint64_t SplitMix64(uint64_t& state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31U);
+}
+
+uint64_t ThreadSeed() {
+  /* Entropy is only queried once per process, threads are told apart by the order they first generate a UUID in */
+  static const uint64_t process_seed = []() {
+    std::random_device random_device;
+
+    const auto time = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return (static_cast<uint64_t>(random_device()) << 32U) ^ static_cast<uint64_t>(random_device()) ^ time;
+  }();
+
+  static std::atomic<uint64_t> thread_counter{0U};
+
+  uint64_t state = process_seed ^ (thread_counter.fetch_add(1U, std::memory_order_relaxed) * 0xD1B54A32D192ED03ULL);
+  return SplitMix64(state);
+}
+
+}  // namespace
+
+UUIDEngine::UUIDEngine(uint64_t seed) {
+  /* Recommended way of seeding xoshiro, which also guarantees a non-zero state */
+  for (auto& word : state_) {
+    word = SplitMix64(seed);
+  }
+}
+
+UUIDEngine& ThisThreadUUIDEngine() {
+  thread_local UUIDEngine engine(ThreadSeed());
+  return engine;
+}
+
+}  // namespace liger::detail
@@ -29,25 +29,278 @@
 
 #include <Liger-Engine/ECS/LogChannel.hpp>
 
+#include <algorithm>
+
 namespace liger::ecs {
 
 ScriptSystem::ScriptSystem(const FrameTimer& frame_timer) : frame_timer_(frame_timer) {}
 
 void ScriptSystem::Setup(entt::registry& registry) {
+  batch_signals_ = &ConstructBatchSignals::Get(registry);
+  batch_signals_->OnConstruct<ScriptComponent>().connect<&ScriptSystem::OnAttachBatch>(this);
+
   registry.on_construct<ScriptComponent>().connect<&ScriptSystem::OnAttach>(this);
+  registry.on_update<ScriptComponent>().connect<&ScriptSystem::OnReplace>(this);
+  registry.on_destroy<ScriptComponent>().connect<&ScriptSystem::OnDetach>(this);
+
+  /* Scripts attached before the system has been set up */
+  for (auto entity : registry.view<ScriptComponent>()) {
+    Attach(registry, entity);
+  }
+}
+
+void ScriptSystem::SetupExecution(entt::organizer& organizer) {
+  organizer.emplace<&ScriptSystem::DeclareAccess>(*this, Name().data());
+}
+
+void ScriptSystem::PrepareRegistry(entt::registry& registry) {
+  [[maybe_unused]] auto view = registry.view<ScriptComponent>();
+}
+
+void ScriptSystem::RunForEach(entt::registry& registry) {
+  updating_ = true;
+
+  scheduler_.Tick(frame_timer_.AbsoluteTime());
+
+  const float dt = ElapsedTime();
+  for (auto& group : groups_) {
+    UpdateBatch(registry, group, 0U, group.entities.size(), dt);
+  }
+
+  FinishUpdate();
+}
+
+void ScriptSystem::RunForEachParallel(entt::registry& registry, tf::Subflow& subflow) {
+  updating_ = true;
+
+  scheduler_.Tick(frame_timer_.AbsoluteTime());
+
+  const float dt = ElapsedTime();
+
+  auto runs_in_parallel = [](const ScriptGroup& group) {
+    return group.thread_safe && group.entities.size() >= kMinParallelBatchSize;
+  };
+
+  /* Scripts which are not thread-safe may access any entity, so they are not run alongside the parallel batches */
+  bool any_parallel = false;
+  for (auto& group : groups_) {
+    if (runs_in_parallel(group)) {
+      any_parallel = true;
+      continue;
+    }
+
+    UpdateBatch(registry, group, 0U, group.entities.size(), dt);
+  }
+
+  if (any_parallel) {
+    const size_t worker_count = subflow.executor().num_workers();
+
+    for (auto& group : groups_) {
+      if (!runs_in_parallel(group)) {
+        continue;
+      }
+
+      const size_t count       = group.entities.size();
+      const size_t batch_size  = detail::ParallelChunkSize(count, kMinParallelBatchSize, worker_count);
+      const size_t batch_count = (count + batch_size - 1U) / batch_size;
+
+      subflow.for_each_index(size_t{0U}, batch_count, size_t{1U},
+                             [this, &registry, &group, count, batch_size, dt](size_t batch) {
+                               UpdateBatch(registry, group, batch * batch_size,
+                                           std::min(count, (batch + 1U) * batch_size), dt);
+                             });
+    }
+
+    subflow.join();
+  }
+
+  FinishUpdate();
+}
+
+float ScriptSystem::ElapsedTime() {
+  const float time = frame_timer_.AbsoluteTime();
+  const float dt   = (last_update_time_ < 0.0f) ? frame_timer_.DeltaTime() : time - last_update_time_;
+
+  last_update_time_ = time;
+  return dt;
 }
 
-void ScriptSystem::Run(entt::registry& registry, entt::entity entity, const ScriptComponent& script) {
+void ScriptSystem::OnAttach(entt::registry& registry, entt::entity entity) {
+  if (!batch_signals_->InBatch<ScriptComponent>()) {
+    Attach(registry, entity);
+  }
+}
+
+void ScriptSystem::OnAttachBatch(entt::registry& registry, std::span<const Entity> entities) {
+  if (updating_) {
+    pending_attach_.reserve(pending_attach_.size() + entities.size());
+  }
+
+  for (auto entity : entities) {
+    Attach(registry, entity);
+  }
+}
+
+void ScriptSystem::Attach(entt::registry& registry, entt::entity entity) {
+  auto& script = registry.get<ScriptComponent>(entity);
   if (!script.script) {
     LIGER_LOG_ERROR(kLogChannelECS, "Nullptr script");
     return;
   }
 
-  script.script->OnUpdate(registry, entity, frame_timer_.DeltaTime());
+  script.script->OnAttach(entity);
+
+  auto task = script.script->Run(registry, entity);
+
+  auto& attachment  = attachments_[entity];
+  attachment.script = script.script.get();
+
+  if (task) {
+    attachment.task = scheduler_.Start(std::move(task));
+    return;
+  }
+
+  if (updating_) {
+    pending_attach_.push_back(entity);
+  } else {
+    AddToGroup(attachment, entity);
+  }
 }
 
-void ScriptSystem::OnAttach(entt::registry& registry, entt::entity entity) {
-  registry.get<ScriptComponent>(entity).script->OnAttach(entity);
+void ScriptSystem::OnReplace(entt::registry& registry, entt::entity entity) {
+  const auto& script = registry.get<ScriptComponent>(entity);
+
+  /* Patched without changing the script */
+  auto it = attachments_.find(entity);
+  if (it != attachments_.end() && it->second.script == script.script.get()) {
+    return;
+  }
+
+  /* The replaced script is already destroyed, only its group entry and coroutine are left */
+  Detach(entity, nullptr);
+  Attach(registry, entity);
+}
+
+void ScriptSystem::OnDetach(entt::registry& registry, entt::entity entity) {
+  Detach(entity, std::move(registry.get<ScriptComponent>(entity).script));
+}
+
+void ScriptSystem::Detach(entt::entity entity, std::unique_ptr<IScript> script) {
+  auto it = attachments_.find(entity);
+  if (it == attachments_.end()) {
+    return;
+  }
+
+  const auto attachment = it->second;
+  attachments_.erase(it);
+
+  if (attachment.task) {
+    scheduler_.Cancel(attachment.task);
+
+    /* The coroutine may be the one detaching its own script, so the script is kept alive until it suspends */
+    if (updating_ && script) {
+      detached_scripts_.emplace_back(std::move(script));
+    }
+    return;
+  }
+
+  if (attachment.group == kNotGrouped) {
+    return;
+  }
+
+  auto&      group = groups_[attachment.group];
+  const auto idx   = attachment.group_idx;
+
+  if (updating_) {
+    /* The group may be iterated right now, so the script is kept alive and removed once the update is finished */
+    group.entities[idx] = entt::null;
+    group.has_detached  = true;
+    if (script) {
+      detached_scripts_.emplace_back(std::move(script));
+    }
+    return;
+  }
+
+  const auto last_idx = static_cast<uint32_t>(group.entities.size() - 1U);
+  if (idx != last_idx) {
+    group.entities[idx] = group.entities[last_idx];
+    group.scripts[idx]  = group.scripts[last_idx];
+    attachments_[group.entities[idx]].group_idx = idx;
+  }
+
+  group.entities.pop_back();
+  group.scripts.pop_back();
+}
+
+void ScriptSystem::AddToGroup(Attachment& attachment, entt::entity entity) {
+  /* Grouped by the dynamic type, so every script of a group runs the same OnUpdateBatch */
+  auto [slot, inserted] = group_slots_.try_emplace(std::type_index(typeid(*attachment.script)),
+                                                   static_cast<uint32_t>(groups_.size()));
+  if (inserted) {
+    groups_.emplace_back().thread_safe = attachment.script->ThreadSafe();
+  }
+
+  auto& group = groups_[slot->second];
+
+  attachment.group     = slot->second;
+  attachment.group_idx = static_cast<uint32_t>(group.entities.size());
+  group.entities.push_back(entity);
+  group.scripts.push_back(attachment.script);
+}
+
+void ScriptSystem::UpdateBatch(entt::registry& registry, ScriptGroup& group, size_t begin, size_t end, float dt) {
+  if (begin == end) {
+    return;
+  }
+
+  const auto scripts  = std::span<IScript* const>(group.scripts).subspan(begin, end - begin);
+  const auto entities = std::span<const Entity>(group.entities).subspan(begin, end - begin);
+
+  /* Scripts of detached entries may already be destroyed, so the batch is dispatched through an attached one */
+  const auto first = std::ranges::find_if(entities, [](Entity entity) { return entity != entt::null; });
+  if (first == entities.end()) {
+    return;
+  }
+
+  scripts[first - entities.begin()]->OnUpdateBatch(registry, scripts, entities, dt);
+}
+
+void ScriptSystem::FinishUpdate() {
+  updating_ = false;
+
+  for (auto& group : groups_) {
+    if (!group.has_detached) {
+      continue;
+    }
+
+    uint32_t kept = 0U;
+    for (size_t idx = 0U; idx < group.entities.size(); ++idx) {
+      if (group.entities[idx] == entt::null) {
+        continue;
+      }
+
+      group.entities[kept] = group.entities[idx];
+      group.scripts[kept]  = group.scripts[idx];
+      attachments_[group.entities[kept]].group_idx = kept;
+      ++kept;
+    }
+
+    group.entities.resize(kept);
+    group.scripts.resize(kept);
+    group.has_detached = false;
+  }
+
+  detached_scripts_.clear();
+
+  /* Entries of scripts detached or replaced since they were attached are stale */
+  for (auto entity : pending_attach_) {
+    auto it = attachments_.find(entity);
+    if (it != attachments_.end() && !it->second.task && it->second.group == kNotGrouped) {
+      AddToGroup(it->second, entity);
+    }
+  }
+
+  pending_attach_.clear();
 }
 
 }  // namespace liger::ecs
\ No newline at end of file
@@ -0,0 +1,107 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file SpatialIndexSystem.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/ECS/BuiltIn/SpatialIndexSystem.hpp>
+
+namespace liger::ecs {
+
+SpatialIndexSystem::SpatialIndexSystem(DynamicBVH::Policy policy) : tree_(policy) {}
+
+void SpatialIndexSystem::Setup(entt::registry& registry) {
+  registry.on_destroy<WorldTransform>().connect<&SpatialIndexSystem::OnIndexedComponentDestroy>(this);
+  registry.on_destroy<Bounds>().connect<&SpatialIndexSystem::OnIndexedComponentDestroy>(this);
+  registry.on_destroy<SpatialProxy>().connect<&SpatialIndexSystem::OnProxyDestroy>(this);
+}
+
+void SpatialIndexSystem::SetupExecution(entt::organizer& organizer) {
+  organizer.emplace<&SpatialIndexSystem::DeclareAccess>(*this, Name().data());
+}
+
+void SpatialIndexSystem::PrepareRegistry(entt::registry& registry) {
+  [[maybe_unused]] auto view = registry.view<WorldTransform, Bounds, SpatialProxy>();
+}
+
+void SpatialIndexSystem::RunForEach(entt::registry& registry) {
+  /* Collected first, emplacing proxies while iterating a view excluding them would skip entities */
+  auto new_view = registry.view<const WorldTransform, const Bounds>(entt::exclude<SpatialProxy>);
+  new_entities_.assign(new_view.begin(), new_view.end());
+
+  for (auto entity : new_entities_) {
+    const auto& transform = registry.get<WorldTransform>(entity);
+    const auto& bounds    = registry.get<Bounds>(entity).box;
+
+    registry.emplace<SpatialProxy>(entity, SpatialProxy{
+      .proxy     = tree_.CreateProxy(WorldBounds(transform, bounds), entt::to_integral(entity)),
+      .transform = transform,
+      .bounds    = bounds
+    });
+  }
+
+  registry.view<const WorldTransform, const Bounds, SpatialProxy>().each(
+      [this](const WorldTransform& transform, const Bounds& bounds, SpatialProxy& proxy) {
+        if (proxy.transform == transform && proxy.bounds == bounds.box) {
+          return;
+        }
+
+        proxy.transform = transform;
+        proxy.bounds    = bounds.box;
+        tree_.MoveProxy(proxy.proxy, WorldBounds(transform, bounds.box));
+      });
+
+  tree_.Commit();
+}
+
+const DynamicBVH& SpatialIndexSystem::GetTree() const { return tree_; }
+
+std::optional<SpatialIndexSystem::RaycastHit> SpatialIndexSystem::RaycastClosest(const Ray& ray,
+                                                                                  float max_distance) const {
+  std::optional<RaycastHit> closest;
+
+  Raycast(ray, max_distance, [&closest](Entity entity, float distance) {
+    if (!closest || distance < closest->distance) {
+      closest = RaycastHit{.entity = entity, .distance = distance};
+    }
+
+    return closest->distance;
+  });
+
+  return closest;
+}
+
+void SpatialIndexSystem::OnIndexedComponentDestroy(entt::registry& registry, entt::entity entity) {
+  registry.remove<SpatialProxy>(entity);
+}
+
+void SpatialIndexSystem::OnProxyDestroy(entt::registry& registry, entt::entity entity) {
+  tree_.DestroyProxy(registry.get<SpatialProxy>(entity).proxy);
+}
+
+AABB SpatialIndexSystem::WorldBounds(const Transform3D& transform, const AABB& bounds) {
+  return bounds.Transformed(transform.Matrix());
+}
+
+}  // namespace liger::ecs
@@ -0,0 +1,295 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file TransformHierarchySystem.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/ECS/BuiltIn/TransformHierarchySystem.hpp>
+
+#include <Liger-Engine/ECS/LogChannel.hpp>
+
+#include <algorithm>
+#include <optional>
+
+namespace liger::ecs {
+
+namespace {
+
+/* Marks nodes on the current parent chain walk while rebuilding, used to detect cycles */
+constexpr uint32_t kVisitingDepth = HierarchyNode::kInvalidDepth - 1;
+
+/* Number of entities processed by a single task in a parallel depth level */
+constexpr uint32_t kChunkSize = 256;
+
+}  // namespace
+
+TransformHierarchySystem::TransformHierarchySystem(tf::Executor& executor) : executor_(executor) {}
+
+void TransformHierarchySystem::Setup(entt::registry& registry) {
+  batch_signals_ = &ConstructBatchSignals::Get(registry);
+  batch_signals_->OnConstruct<LocalTransform>().connect<&TransformHierarchySystem::OnLocalTransformConstructBatch>(this);
+
+  registry.on_construct<LocalTransform>().connect<&TransformHierarchySystem::OnLocalTransformConstruct>(this);
+  registry.on_update<LocalTransform>().connect<&TransformHierarchySystem::OnLocalTransformUpdate>(this);
+  registry.on_destroy<LocalTransform>().connect<&TransformHierarchySystem::OnLocalTransformDestroy>(this);
+
+  registry.on_construct<Parent>().connect<&TransformHierarchySystem::OnParentChange>(this);
+  registry.on_update<Parent>().connect<&TransformHierarchySystem::OnParentChange>(this);
+  registry.on_destroy<Parent>().connect<&TransformHierarchySystem::OnParentChange>(this);
+
+  /* Entities created before the system has been set up */
+  for (auto entity : registry.view<LocalTransform>()) {
+    OnLocalTransformConstruct(registry, entity);
+  }
+}
+
+void TransformHierarchySystem::SetupExecution(entt::organizer& organizer) {
+  organizer.emplace<&TransformHierarchySystem::DeclareAccess>(*this, Name().data());
+}
+
+void TransformHierarchySystem::PrepareRegistry(entt::registry& registry) {
+  [[maybe_unused]] auto view = registry.view<LocalTransform, Parent, WorldTransform, HierarchyNode>();
+}
+
+void TransformHierarchySystem::RunForEach(entt::registry& registry) {
+  const bool structure_dirty = structure_dirty_.exchange(false);
+  const bool any_dirty       = any_dirty_.exchange(false);
+
+  /* Nothing to recompute, and no changed flags from the last frame to reset */
+  if (!structure_dirty && !any_dirty && !changed_last_frame_) {
+    return;
+  }
+
+  if (structure_dirty) {
+    RebuildHierarchy(registry);
+    BuildTaskflow(registry);
+  }
+
+  if (!parallel_) {
+    ProcessRange(registry, 0U, static_cast<uint32_t>(sorted_entities_.size()));
+  } else if (executor_.this_worker_id() >= 0) {
+    executor_.corun(taskflow_);
+  } else {
+    executor_.run(taskflow_).wait();
+  }
+
+  changed_last_frame_ = structure_dirty || any_dirty;
+}
+
+void TransformHierarchySystem::OnLocalTransformConstruct(entt::registry& registry, entt::entity entity) {
+  if (batch_signals_->InBatch<LocalTransform>()) {
+    return;
+  }
+
+  registry.emplace_or_replace<HierarchyNode>(entity);
+
+  if (!registry.all_of<WorldTransform>(entity)) {
+    registry.emplace<WorldTransform>(entity);
+  }
+
+  structure_dirty_.store(true, std::memory_order_relaxed);
+  any_dirty_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchySystem::OnLocalTransformConstructBatch(entt::registry& registry,
+                                                              std::span<const Entity> entities) {
+  auto& nodes = registry.storage<HierarchyNode>();
+  nodes.reserve(nodes.size() + entities.size());
+
+  for (auto entity : entities) {
+    registry.emplace_or_replace<HierarchyNode>(entity);
+
+    if (!registry.all_of<WorldTransform>(entity)) {
+      registry.emplace<WorldTransform>(entity);
+    }
+  }
+
+  structure_dirty_.store(true, std::memory_order_relaxed);
+  any_dirty_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchySystem::OnLocalTransformUpdate(entt::registry& registry, entt::entity entity) {
+  registry.get<HierarchyNode>(entity).dirty = true;
+  any_dirty_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchySystem::OnLocalTransformDestroy(entt::registry& registry, entt::entity entity) {
+  registry.remove<HierarchyNode>(entity);
+  structure_dirty_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchySystem::OnParentChange(entt::registry& registry, entt::entity entity) {
+  if (auto* node = registry.try_get<HierarchyNode>(entity); node != nullptr) {
+    node->dirty = true;
+  }
+
+  structure_dirty_.store(true, std::memory_order_relaxed);
+  any_dirty_.store(true, std::memory_order_relaxed);
+}
+
+void TransformHierarchySystem::RebuildHierarchy(entt::registry& registry) {
+  auto& nodes = registry.storage<HierarchyNode>();
+
+  for (auto entity : nodes) {
+    nodes.get(entity).depth = HierarchyNode::kInvalidDepth;
+  }
+
+  /* Calculate depths by walking up the parent chain until a node with known depth or a root is reached */
+  uint32_t max_depth = 0U;
+
+  for (auto entity : nodes) {
+    if (nodes.get(entity).depth != HierarchyNode::kInvalidDepth) {
+      continue;
+    }
+
+    chain_.clear();
+
+    Entity   current = entity;
+    uint32_t depth   = 0U;
+    while (true) {
+      auto& node = nodes.get(current);
+      node.depth = kVisitingDepth;
+      chain_.push_back(current);
+
+      Entity   parent_entity = entt::null;
+      uint32_t parent_depth  = HierarchyNode::kInvalidDepth;
+
+      const auto* parent = registry.try_get<Parent>(current);
+      if (parent != nullptr && nodes.contains(parent->entity)) {
+        parent_depth = nodes.get(parent->entity).depth;
+
+        if (parent_depth == kVisitingDepth) {
+          LIGER_LOG_ERROR(kLogChannelECS, "Cycle found in the transform hierarchy, breaking it");
+        } else {
+          parent_entity = parent->entity;
+        }
+      }
+
+      /* E.g. children of a removed node become roots, so their world transforms must be recomputed */
+      if (node.parent != parent_entity) {
+        node.parent = parent_entity;
+        node.dirty  = true;
+      }
+
+      if (parent_entity == entt::null) {
+        break;
+      }
+
+      if (parent_depth != HierarchyNode::kInvalidDepth) {
+        depth = parent_depth + 1U;
+        break;
+      }
+
+      current = parent_entity;
+    }
+
+    for (auto it = chain_.rbegin(); it != chain_.rend(); ++it) {
+      nodes.get(*it).depth = depth++;
+    }
+
+    max_depth = std::max(max_depth, depth - 1U);
+  }
+
+  /* Counting sort by depth, so that each depth level is a contiguous range */
+  level_offsets_.assign(max_depth + 2U, 0U);
+  for (auto entity : nodes) {
+    ++level_offsets_[nodes.get(entity).depth + 1U];
+  }
+
+  for (uint32_t level = 1U; level < level_offsets_.size(); ++level) {
+    level_offsets_[level] += level_offsets_[level - 1U];
+  }
+
+  sorted_entities_.resize(nodes.size());
+
+  /* Offsets are used as write cursors, after which each one points to the end of its level */
+  for (auto entity : nodes) {
+    sorted_entities_[level_offsets_[nodes.get(entity).depth]++] = entity;
+  }
+
+  for (uint32_t level = max_depth + 1U; level > 0U; --level) {
+    level_offsets_[level] = level_offsets_[level - 1U];
+  }
+  level_offsets_[0U] = 0U;
+}
+
+void TransformHierarchySystem::BuildTaskflow(entt::registry& registry) {
+  taskflow_.clear();
+
+  parallel_ = sorted_entities_.size() >= kMinParallelLevelSize;
+  if (!parallel_) {
+    return;
+  }
+
+  std::optional<tf::Task> prev_level_task;
+  for (uint32_t level = 0U; level + 1U < level_offsets_.size(); ++level) {
+    const uint32_t begin = level_offsets_[level];
+    const uint32_t end   = level_offsets_[level + 1U];
+
+    tf::Task level_task;
+    if (end - begin >= kMinParallelLevelSize) {
+      const uint32_t chunks = (end - begin + kChunkSize - 1U) / kChunkSize;
+
+      level_task = taskflow_.for_each_index(0U, chunks, 1U, [this, &registry, begin, end](uint32_t chunk) {
+        ProcessRange(registry, begin + chunk * kChunkSize, std::min(end, begin + (chunk + 1U) * kChunkSize));
+      });
+    } else {
+      level_task = taskflow_.emplace([this, &registry, begin, end]() { ProcessRange(registry, begin, end); });
+    }
+
+    if (prev_level_task) {
+      prev_level_task->precede(level_task);
+    }
+
+    prev_level_task = level_task;
+  }
+}
+
+void TransformHierarchySystem::ProcessRange(entt::registry& registry, uint32_t begin, uint32_t end) {
+  auto& nodes  = registry.storage<HierarchyNode>();
+  auto& locals = registry.storage<LocalTransform>();
+  auto& worlds = registry.storage<WorldTransform>();
+
+  for (uint32_t idx = begin; idx < end; ++idx) {
+    const Entity entity = sorted_entities_[idx];
+    auto&        node   = nodes.get(entity);
+
+    /* Parents are at lower depth levels, so they have already been processed */
+    const bool has_parent = (node.parent != entt::null);
+
+    node.changed = node.dirty || (has_parent && nodes.get(node.parent).changed);
+    node.dirty   = false;
+
+    if (!node.changed) {
+      continue;
+    }
+
+    const Transform3D& local = locals.get(entity);
+    Transform3D&       world = worlds.get(entity);
+
+    world = has_parent ? static_cast<const Transform3D&>(worlds.get(node.parent)).Combine(local) : local;
+  }
+}
+
+}  // namespace liger::ecs
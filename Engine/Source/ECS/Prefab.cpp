@@ -0,0 +1,83 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file Prefab.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/ECS/Prefab.hpp>
+
+#include <Liger-Engine/ECS/LogChannel.hpp>
+
+namespace liger::ecs {
+
+namespace {
+
+template <typename TransformComponent>
+void InsertTransforms(entt::registry& registry, ConstructBatchSignals& signals, std::span<const Entity> entities,
+                      std::span<const Transform3D> transforms) {
+  std::vector<TransformComponent> components;
+  components.reserve(transforms.size());
+
+  for (const auto& transform : transforms) {
+    components.push_back(TransformComponent{transform});
+  }
+
+  signals.Insert<TransformComponent>(registry, entities, components.cbegin());
+}
+
+}  // namespace
+
+void Prefab::Instantiate(entt::registry& registry, std::span<const Entity> entities,
+                         std::span<const Transform3D> transforms) const {
+  LIGER_ASSERT(entities.size() == transforms.size(), kLogChannelECS,
+               "Number of entities must be the same as the number of transforms");
+
+  if (entities.empty()) {
+    return;
+  }
+
+  auto& signals = ConstructBatchSignals::Get(registry);
+
+  /* World transforms first, as listeners of the local ones only create them if missing */
+  InsertTransforms<WorldTransform>(registry, signals, entities, transforms);
+  if (local_transform_) {
+    InsertTransforms<LocalTransform>(registry, signals, entities, transforms);
+  }
+
+  for (const auto& entry : components_) {
+    entry.component->Instantiate(registry, signals, entities);
+  }
+}
+
+void Prefab::AddTemplate(TypeSlotId type, std::unique_ptr<IComponentTemplate> component) {
+  auto it = std::find_if(components_.begin(), components_.end(), [type](const auto& entry) { return entry.type == type; });
+  if (it != components_.end()) {
+    it->component = std::move(component);
+    return;
+  }
+
+  components_.emplace_back(Entry{type, std::move(component)});
+}
+
+}  // namespace liger::ecs
@@ -27,12 +27,29 @@
 
 #include <Liger-Engine/ECS/Scene.hpp>
 
+#include <Liger-Engine/ECS/LogChannel.hpp>
+#include <Liger-Engine/ECS/Prefab.hpp>
+
 namespace liger::ecs {
 
 Entity Scene::CreateEntity(std::string_view) {
   return registry_.create();
 }
 
+std::vector<Entity> Scene::Instantiate(const Prefab& prefab, std::span<const Transform3D> transforms) {
+  std::vector<Entity> entities(transforms.size());
+  Instantiate(prefab, transforms, entities);
+  return entities;
+}
+
+void Scene::Instantiate(const Prefab& prefab, std::span<const Transform3D> transforms, std::span<Entity> entities) {
+  LIGER_ASSERT(entities.size() == transforms.size(), kLogChannelECS,
+               "Number of entities must be the same as the number of transforms");
+
+  registry_.create(entities.begin(), entities.end());
+  prefab.Instantiate(registry_, entities, transforms);
+}
+
 entt::registry& Scene::GetRegistry() { return registry_; }
 
 }  // namespace liger::ecs
\ No newline at end of file
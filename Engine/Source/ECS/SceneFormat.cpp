@@ -0,0 +1,405 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file SceneFormat.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/ECS/SceneFormat.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+
+namespace liger::ecs {
+
+namespace {
+
+constexpr uint32_t kSceneMagic   = 0x4E43534CU;  // "LSCN"
+constexpr uint32_t kSceneVersion = 2U;
+
+struct FileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t entity_count;
+  uint32_t column_count;
+  uint32_t asset_count;
+  uint32_t reserved;
+  uint64_t assets_offset;
+};
+
+struct FileColumn {
+  SceneTypeId type;
+  uint32_t    stored_size;
+  uint32_t    count;
+  uint64_t    entities_offset;
+  uint64_t    data_offset;
+};
+
+constexpr uint64_t AlignBlob(uint64_t offset) {
+  return (offset + SceneFormat::kBlobAlignment - 1U) & ~uint64_t{SceneFormat::kBlobAlignment - 1U};
+}
+
+bool InRange(uint64_t offset, uint64_t size, uint64_t file_size) {
+  return offset % SceneFormat::kBlobAlignment == 0U && offset <= file_size && size <= file_size - offset;
+}
+
+}  // namespace
+
+/************************************************************************************************
+ * Contexts
+ ************************************************************************************************/
+SceneWriteContext::SceneWriteContext(const SceneFormat& format,
+                                     const std::unordered_map<Entity, uint32_t>& entity_indices)
+    : format_(format), entity_indices_(entity_indices) {}
+
+uint32_t SceneWriteContext::EntityIndex(Entity entity) const {
+  auto it = entity_indices_.find(entity);
+  return it != entity_indices_.end() ? it->second : kNullEntity;
+}
+
+std::span<const SceneAssetRef> SceneWriteContext::Assets() const { return assets_; }
+
+void SceneWriteContext::ReferenceAsset(asset::Id id, SceneTypeId type) {
+  if (referenced_assets_.insert(id).second) {
+    assets_.push_back(SceneAssetRef{.id = id, .type = type});
+  }
+}
+
+SceneReadContext::SceneReadContext(asset::Manager* asset_manager) : asset_manager_(asset_manager) {}
+
+Entity SceneReadContext::GetEntity(uint32_t index) const {
+  return index < entities_.size() ? entities_[index] : Entity{entt::null};
+}
+
+/************************************************************************************************
+ * File
+ ************************************************************************************************/
+bool SceneFile::Open(const std::filesystem::path& filepath) {
+  entity_count_ = 0U;
+  columns_.clear();
+  assets_ = {};
+
+  if (!file_.Open(filepath)) {
+    return false;
+  }
+
+  auto invalid = [&]() {
+    LIGER_LOG_ERROR(kLogChannelECS, "File '{0}' is not a valid scene file", filepath.string());
+    file_.Close();
+    columns_.clear();
+    return false;
+  };
+
+  const auto  data = file_.Data();
+  const auto* base = data.data();
+
+  FileHeader header;
+  if (data.size() < sizeof(header)) {
+    return invalid();
+  }
+
+  std::memcpy(&header, base, sizeof(header));
+  if (header.magic != kSceneMagic || header.version != kSceneVersion ||
+      !InRange(sizeof(header), uint64_t{header.column_count} * sizeof(FileColumn), data.size()) ||
+      !InRange(header.assets_offset, uint64_t{header.asset_count} * sizeof(SceneAssetRef), data.size())) {
+    return invalid();
+  }
+
+  columns_.reserve(header.column_count);
+  for (uint32_t column_idx = 0U; column_idx < header.column_count; ++column_idx) {
+    FileColumn column;
+    std::memcpy(&column, base + sizeof(header) + column_idx * sizeof(FileColumn), sizeof(column));
+
+    if (!InRange(column.entities_offset, uint64_t{column.count} * sizeof(uint32_t), data.size()) ||
+        !InRange(column.data_offset, uint64_t{column.count} * column.stored_size, data.size())) {
+      return invalid();
+    }
+
+    /* Strictly increasing indices rule out duplicates, which the bulk insertion of the column does not handle */
+    const auto* entities = reinterpret_cast<const uint32_t*>(base + column.entities_offset);
+    if ((column.count > 0U && entities[column.count - 1U] >= header.entity_count) ||
+        std::adjacent_find(entities, entities + column.count, std::greater_equal<>()) != entities + column.count) {
+      return invalid();
+    }
+
+    columns_.push_back(Column{
+      .type        = column.type,
+      .stored_size = column.stored_size,
+      .entities    = entities,
+      .data        = base + column.data_offset,
+      .count       = column.count
+    });
+  }
+
+  entity_count_ = header.entity_count;
+  assets_       = {reinterpret_cast<const SceneAssetRef*>(base + header.assets_offset), header.asset_count};
+
+  return true;
+}
+
+uint32_t SceneFile::EntityCount() const { return entity_count_; }
+
+std::span<const SceneAssetRef> SceneFile::Assets() const { return assets_; }
+
+/************************************************************************************************
+ * Format
+ ************************************************************************************************/
+void SceneFormat::RegisterDefaultComponents() {
+  RegisterComponent<WorldTransform>("WorldTransform");
+  RegisterComponent<LocalTransform>("LocalTransform");
+  RegisterComponent<Parent>("Parent");
+  RegisterComponent<Camera>("Camera");
+}
+
+void SceneFormat::AddColumn(std::string_view name, std::unique_ptr<ISceneColumn> column) {
+  const auto id = HashSceneTypeName(name);
+  LIGER_ASSERT(std::none_of(columns_.begin(), columns_.end(), [id](const auto& other) { return other.id == id; }),
+               kLogChannelECS, "Component '{0}' is already registered in the scene format", name);
+
+  columns_.push_back(ColumnType{.id = id, .name = std::string(name), .column = std::move(column)});
+}
+
+void SceneFormat::AddAssetType(std::string_view name, TypeSlotId slot,
+                               void (*request)(SceneReadContext&, asset::Id)) {
+  const auto id = HashSceneTypeName(name);
+  LIGER_ASSERT(id != kUnregisteredAsset &&
+                   std::none_of(asset_types_.begin(), asset_types_.end(),
+                                [id](const auto& other) { return other.id == id; }),
+               kLogChannelECS, "Asset type '{0}' is already registered in the scene format", name);
+
+  if (slot >= asset_type_by_slot_.size()) {
+    asset_type_by_slot_.resize(slot + 1U, kUnregisteredAsset);
+  }
+
+  asset_type_by_slot_[slot] = id;
+  asset_types_.push_back(AssetType{.id = id, .name = std::string(name), .request = request});
+}
+
+bool SceneFormat::Save(Scene& scene, const std::filesystem::path& filepath) const {
+  auto& registry = scene.GetRegistry();
+
+  /* Entities are indexed in the order of their first appearance, so the first column's indices are sequential */
+  std::vector<std::vector<Entity>>     column_entities(columns_.size());
+  std::unordered_map<Entity, uint32_t> entity_indices;
+
+  for (size_t column_idx = 0U; column_idx < columns_.size(); ++column_idx) {
+    columns_[column_idx].column->CollectEntities(registry, column_entities[column_idx]);
+
+    for (auto entity : column_entities[column_idx]) {
+      entity_indices.try_emplace(entity, static_cast<uint32_t>(entity_indices.size()));
+    }
+  }
+
+  /* Each column is stored in the order of the entity indices, which the loader requires */
+  for (auto& entities : column_entities) {
+    std::sort(entities.begin(), entities.end(),
+              [&](Entity lhs, Entity rhs) { return entity_indices.at(lhs) < entity_indices.at(rhs); });
+  }
+
+  /* Layout: header, column table, per-column entity indices and component blobs, asset table */
+  std::vector<FileColumn> file_columns(columns_.size());
+
+  uint64_t size = AlignBlob(sizeof(FileHeader) + file_columns.size() * sizeof(FileColumn));
+  for (size_t column_idx = 0U; column_idx < columns_.size(); ++column_idx) {
+    auto&      file_column = file_columns[column_idx];
+    const auto count       = static_cast<uint32_t>(column_entities[column_idx].size());
+
+    file_column.type            = columns_[column_idx].id;
+    file_column.stored_size     = columns_[column_idx].column->StoredSize();
+    file_column.count           = count;
+    file_column.entities_offset = size;
+    file_column.data_offset     = AlignBlob(size + uint64_t{count} * sizeof(uint32_t));
+
+    size = AlignBlob(file_column.data_offset + uint64_t{count} * file_column.stored_size);
+  }
+
+  std::vector<std::byte> data(size);
+
+  SceneWriteContext context(*this, entity_indices);
+  for (size_t column_idx = 0U; column_idx < columns_.size(); ++column_idx) {
+    const auto& entities    = column_entities[column_idx];
+    const auto& file_column = file_columns[column_idx];
+
+    auto* indices = reinterpret_cast<uint32_t*>(data.data() + file_column.entities_offset);
+    for (size_t idx = 0U; idx < entities.size(); ++idx) {
+      indices[idx] = entity_indices[entities[idx]];
+    }
+
+    columns_[column_idx].column->Save(registry, entities, context, data.data() + file_column.data_offset);
+  }
+
+  const auto assets = context.Assets();
+
+  const FileHeader header{
+    .magic         = kSceneMagic,
+    .version       = kSceneVersion,
+    .entity_count  = static_cast<uint32_t>(entity_indices.size()),
+    .column_count  = static_cast<uint32_t>(file_columns.size()),
+    .asset_count   = static_cast<uint32_t>(assets.size()),
+    .reserved      = 0U,
+    .assets_offset = size
+  };
+
+  std::memcpy(data.data(), &header, sizeof(header));
+  std::memcpy(data.data() + sizeof(header), file_columns.data(), file_columns.size() * sizeof(FileColumn));
+
+  std::ofstream file(filepath, std::ios::binary);
+  if (!file.is_open()) {
+    LIGER_LOG_ERROR(kLogChannelECS, "Failed to open file '{0}' for saving the scene", filepath.string());
+    return false;
+  }
+
+  file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+  file.write(reinterpret_cast<const char*>(assets.data()), static_cast<std::streamsize>(assets.size_bytes()));
+
+  return file.good();
+}
+
+bool SceneFormat::Load(const SceneFile& file, Scene& scene, asset::Manager& asset_manager) const {
+  return Load(file, scene, &asset_manager);
+}
+
+bool SceneFormat::Load(const SceneFile& file, Scene& scene) const {
+  return Load(file, scene, nullptr);
+}
+
+bool SceneFormat::LoadPrefab(const SceneFile& file, Prefab& prefab, asset::Manager& asset_manager) const {
+  if (!file.file_.Valid()) {
+    LIGER_LOG_ERROR(kLogChannelECS, "Trying to load a prefab from a file which is not open");
+    return false;
+  }
+
+  if (file.entity_count_ == 0U) {
+    LIGER_LOG_ERROR(kLogChannelECS, "Prefab file has no entities");
+    return false;
+  }
+
+  if (file.entity_count_ > 1U) {
+    LIGER_LOG_WARN(kLogChannelECS, "Prefab file has {0} entities, only the first one is used", file.entity_count_);
+  }
+
+  std::vector<const SceneFile::Column*> file_columns;
+  if (!MatchColumns(file, file_columns)) {
+    return false;
+  }
+
+  SceneReadContext context(&asset_manager);
+  RequestAssets(file, context);
+
+  for (size_t column_idx = 0U; column_idx < columns_.size(); ++column_idx) {
+    const auto* column = file_columns[column_idx];
+    if (column == nullptr) {
+      continue;
+    }
+
+    /* Indices are sorted, so the first entity can only be the first one in the column */
+    if (column->count > 0U && column->entities[0U] == 0U) {
+      columns_[column_idx].column->LoadTemplate(prefab, column->data, context);
+    }
+  }
+
+  return true;
+}
+
+bool SceneFormat::MatchColumns(const SceneFile& file, std::vector<const SceneFile::Column*>& file_columns) const {
+  file_columns.assign(columns_.size(), nullptr);
+
+  for (const auto& column : file.columns_) {
+    auto it = std::find_if(columns_.begin(), columns_.end(), [&](const auto& type) { return type.id == column.type; });
+    if (it == columns_.end()) {
+      LIGER_LOG_WARN(kLogChannelECS, "Skipping unregistered component column 0x{0:X}", column.type);
+      continue;
+    }
+
+    if (it->column->StoredSize() != column.stored_size) {
+      LIGER_LOG_ERROR(kLogChannelECS, "Component '{0}' is stored with size {1}, but expected {2}", it->name,
+                      column.stored_size, it->column->StoredSize());
+      return false;
+    }
+
+    file_columns[it - columns_.begin()] = &column;
+  }
+
+  return true;
+}
+
+void SceneFormat::RequestAssets(const SceneFile& file, SceneReadContext& context) const {
+  for (const auto& asset : file.assets_) {
+    auto it = std::find_if(asset_types_.begin(), asset_types_.end(), [&](const auto& type) { return type.id == asset.type; });
+    if (it == asset_types_.end()) {
+      LIGER_LOG_WARN(kLogChannelECS, "Skipping asset 0x{0:X} of unregistered type 0x{1:X}", asset.id.Value(),
+                     asset.type);
+      continue;
+    }
+
+    it->request(context, asset.id);
+  }
+}
+
+bool SceneFormat::Load(const SceneFile& file, Scene& scene, asset::Manager* asset_manager) const {
+  if (!file.file_.Valid()) {
+    LIGER_LOG_ERROR(kLogChannelECS, "Trying to load a scene from a file which is not open");
+    return false;
+  }
+
+  if (asset_manager == nullptr && !file.assets_.empty()) {
+    LIGER_LOG_ERROR(kLogChannelECS, "Scene references {0} assets, but no asset manager is provided",
+                    file.assets_.size());
+    return false;
+  }
+
+  /* Match the file's columns against the registered ones before modifying the scene */
+  std::vector<const SceneFile::Column*> file_columns;
+  if (!MatchColumns(file, file_columns)) {
+    return false;
+  }
+
+  SceneReadContext context(asset_manager);
+  RequestAssets(file, context);
+
+  auto& registry = scene.GetRegistry();
+
+  std::vector<Entity> entities(file.entity_count_);
+  registry.create(entities.begin(), entities.end());
+  context.entities_ = entities;
+
+  std::vector<Entity> column_entities;
+  for (size_t column_idx = 0U; column_idx < columns_.size(); ++column_idx) {
+    const auto* column = file_columns[column_idx];
+    if (column == nullptr || column->count == 0U) {
+      continue;
+    }
+
+    column_entities.resize(column->count);
+    for (uint32_t idx = 0U; idx < column->count; ++idx) {
+      column_entities[idx] = entities[column->entities[idx]];
+    }
+
+    columns_[column_idx].column->Load(registry, column_entities, column->data, context);
+  }
+
+  return true;
+}
+
+}  // namespace liger::ecs
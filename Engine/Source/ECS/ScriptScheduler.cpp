@@ -0,0 +1,186 @@
+/**
+ * @author Nikita Mochalov (github.com/tralf-strues)
+ * @file ScriptScheduler.cpp
+ * @date 2026-10-18
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 Nikita Mochalov
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <Liger-Engine/ECS/ScriptScheduler.hpp>
+
+#include <Liger-Engine/ECS/LogChannel.hpp>
+
+#include <utility>
+
+namespace liger::ecs {
+
+void ScriptTask::promise_type::unhandled_exception() {
+  LIGER_LOG_ERROR(kLogChannelECS, "Unhandled exception in a script coroutine, the coroutine is finished");
+}
+
+ScriptTask::~ScriptTask() {
+  if (handle_) {
+    handle_.destroy();
+  }
+}
+
+ScriptTask::ScriptTask(ScriptTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+ScriptTask& ScriptTask::operator=(ScriptTask&& other) noexcept {
+  if (this != &other) {
+    if (handle_) {
+      handle_.destroy();
+    }
+
+    handle_ = std::exchange(other.handle_, nullptr);
+  }
+
+  return *this;
+}
+
+SlotHandle ScriptScheduler::Start(ScriptTask task) {
+  LIGER_ASSERT(task, kLogChannelECS, "Trying to start an empty script task");
+
+  auto       handle = task.handle_;
+  const auto slot   = tasks_.Emplace(std::move(task));
+
+  handle.promise().scheduler = this;
+  handle.promise().self      = slot;
+
+  next_frame_.push_back(slot);
+  return slot;
+}
+
+void ScriptScheduler::Cancel(SlotHandle task) {
+  if (!tasks_.Contains(task)) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(event_mutex_);
+    for (auto& list : event_lists_) {
+      list->Cancel(task);
+    }
+  }
+
+  /* A running coroutine cannot be destroyed, it is destroyed once it suspends */
+  if (task == running_) {
+    cancel_running_ = true;
+    return;
+  }
+
+  /* Stale handles left in the other wait lists are skipped */
+  tasks_.Erase(task);
+}
+
+void ScriptScheduler::Tick(float time) {
+  time_ = time;
+
+  /* Coroutines suspended during this tick are resumed on the next one at the earliest */
+  resuming_.clear();
+  std::swap(resuming_, next_frame_);
+
+  while (!timers_.empty() && timers_.top().time <= time_) {
+    resuming_.push_back(timers_.top().task);
+    timers_.pop();
+  }
+
+  for (size_t idx = 0U; idx < conditions_.size();) {
+    const auto& condition = conditions_[idx];
+
+    const bool stale = !tasks_.Contains(condition.task);
+    if (stale || condition.ready(condition.context)) {
+      if (!stale) {
+        resuming_.push_back(condition.task);
+      }
+
+      conditions_[idx] = conditions_.back();
+      conditions_.pop_back();
+    } else {
+      ++idx;
+    }
+  }
+
+  {
+    std::lock_guard lock(event_mutex_);
+    resuming_.insert(resuming_.end(), events_ready_.begin(), events_ready_.end());
+    events_ready_.clear();
+  }
+
+  for (auto task : resuming_) {
+    Resume(task);
+  }
+
+  DisconnectIdleEvents();
+}
+
+void ScriptScheduler::WaitNextFrame(SlotHandle task) {
+  next_frame_.push_back(task);
+}
+
+void ScriptScheduler::WaitFor(SlotHandle task, float seconds) {
+  timers_.push(Timer{.time = time_ + seconds, .task = task});
+}
+
+void ScriptScheduler::WaitUntil(SlotHandle task, bool (*ready)(const void*), const void* context) {
+  conditions_.emplace_back(Condition{.task = task, .ready = ready, .context = context});
+}
+
+void ScriptScheduler::DisconnectIdleEvents() {
+  {
+    std::lock_guard lock(event_mutex_);
+
+    for (size_t idx = 0U; idx < event_lists_.size();) {
+      if (event_lists_[idx]->Empty()) {
+        idle_event_lists_.emplace_back(std::move(event_lists_[idx]));
+        event_lists_[idx] = std::move(event_lists_.back());
+        event_lists_.pop_back();
+      } else {
+        ++idx;
+      }
+    }
+  }
+
+  /* Disconnected outside of the event mutex, a dispatching thread may hold the sink's lock while waiting for it */
+  idle_event_lists_.clear();
+}
+
+void ScriptScheduler::Resume(SlotHandle task) {
+  auto* script_task = tasks_.Get(task);
+  if (script_task == nullptr) {
+    return;
+  }
+
+  /* Resumed coroutines may start new ones, which can reallocate the tasks */
+  auto handle = script_task->handle_;
+
+  running_ = task;
+  handle.resume();
+  running_ = SlotHandle{};
+
+  if (handle.done() || cancel_running_) {
+    cancel_running_ = false;
+    Cancel(task);
+  }
+}
+
+}  // namespace liger::ecs
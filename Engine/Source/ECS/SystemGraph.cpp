@@ -29,7 +29,10 @@
 
 #include <Liger-Engine/ECS/LogChannel.hpp>
 
+#include <Liger-Engine/Core/Time.hpp>
+
 #include <algorithm>
+#include <cmath>
 
 namespace liger::ecs {
 
@@ -41,6 +44,8 @@ void SystemGraph::Emplace(std::unique_ptr<ISystem> system) {
 void SystemGraph::Insert(ISystem* system) {
   system->SetupExecution(organizer_);
   systems_.push_back(system);
+  controls_.emplace_back();
+  stats_.emplace_back(SystemStats{.name = system->Name()});
 }
 
 tf::Taskflow SystemGraph::Build(Scene& scene) {
@@ -52,9 +57,13 @@ tf::Taskflow SystemGraph::Build(Scene& scene) {
 
   // NOLINTNEXTLINE(modernize-loop-convert)
   for (uint32_t node_idx = 0U; node_idx < graph_.size(); ++node_idx) {
-    auto task = taskflow.emplace([this, &scene, node_idx]() {
-      auto& system = const_cast<ISystem&>(*reinterpret_cast<const ISystem*>(graph_[node_idx].data()));
-      system.RunForEach(scene.GetRegistry());
+    const auto* system     = reinterpret_cast<const ISystem*>(graph_[node_idx].data());
+    const auto  system_it  = std::find(systems_.begin(), systems_.end(), system);
+    const auto  system_idx = static_cast<uint32_t>(system_it - systems_.begin());
+    LIGER_ASSERT(system_idx < systems_.size(), kLogChannelECS, "Graph node is not one of the inserted systems");
+
+    auto task = taskflow.emplace([this, &scene, system_idx](tf::Subflow& subflow) {
+      RunSystem(system_idx, scene, subflow);
     });
 
     task.name(graph_[node_idx].name());
@@ -75,4 +84,90 @@ tf::Taskflow SystemGraph::Build(Scene& scene) {
   return taskflow;
 }
 
-}  // namespace liger::ecs
\ No newline at end of file
+bool SystemGraph::SetEnabled(std::string_view name, bool enabled) {
+  auto* control = FindControl(name);
+  if (control != nullptr) {
+    control->enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  return control != nullptr;
+}
+
+bool SystemGraph::SetFrameInterval(std::string_view name, uint32_t frame_interval) {
+  auto* control = FindControl(name);
+  if (control != nullptr) {
+    control->frame_interval.store(std::max(frame_interval, 1U), std::memory_order_relaxed);
+  }
+
+  return control != nullptr;
+}
+
+bool SystemGraph::SetBudget(std::string_view name, float budget_ms) {
+  auto* control = FindControl(name);
+  if (control != nullptr) {
+    control->budget_ms.store(std::max(budget_ms, 0.0f), std::memory_order_relaxed);
+  }
+
+  return control != nullptr;
+}
+
+std::span<const SystemGraph::SystemStats> SystemGraph::GetStats() const { return stats_; }
+
+SystemGraph::SystemControl* SystemGraph::FindControl(std::string_view name) {
+  auto it = std::find_if(systems_.begin(), systems_.end(), [name](const auto* system) { return system->Name() == name; });
+  if (it == systems_.end()) {
+    LIGER_LOG_WARN(kLogChannelECS, "There is no system '{0}' in the graph", name);
+    return nullptr;
+  }
+
+  return &controls_[it - systems_.begin()];
+}
+
+bool SystemGraph::ShouldRun(SystemControl& control, SystemStats& stats) {
+  if (!control.enabled.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  uint32_t frame_interval = control.frame_interval.load(std::memory_order_relaxed);
+
+  const float budget_ms = control.budget_ms.load(std::memory_order_relaxed);
+  if (budget_ms > 0.0f && stats.average_ms > budget_ms) {
+    frame_interval = std::max(frame_interval, static_cast<uint32_t>(std::ceil(stats.average_ms / budget_ms)));
+  }
+
+  stats.frame_interval = frame_interval;
+
+  if (control.wait_frames > 0U) {
+    control.wait_frames = std::min(control.wait_frames, frame_interval) - 1U;
+    return false;
+  }
+
+  control.wait_frames = frame_interval - 1U;
+  return true;
+}
+
+void SystemGraph::RunSystem(uint32_t system_idx, Scene& scene, tf::Subflow& subflow) {
+  auto& system = *systems_[system_idx];
+  auto& stats  = stats_[system_idx];
+
+  if (!ShouldRun(controls_[system_idx], stats)) {
+    ++stats.skip_count;
+    return;
+  }
+
+  Timer timer;
+
+  if (system.MinParallelChunkSize() > 0U) {
+    system.RunForEachParallel(scene.GetRegistry(), subflow);
+  } else {
+    system.RunForEach(scene.GetRegistry());
+  }
+
+  stats.last_ms     = timer.ElapsedMs();
+  stats.average_ms  = (stats.run_count == 0U) ? stats.last_ms
+                                              : stats.average_ms + kAverageWeight * (stats.last_ms - stats.average_ms);
+  stats.total_ms   += stats.last_ms;
+  ++stats.run_count;
+}
+
+}  // namespace liger::ecs
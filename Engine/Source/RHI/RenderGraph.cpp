@@ -301,18 +301,33 @@ std::unique_ptr<RenderGraph> RenderGraphBuilder::Build(IDevice& device, std::str
   auto& dag     = graph_->dag_;
   graph_->name_ = name;
 
-  for (auto& from : dag) {
-    for (auto& to : dag) {
-      for (auto from_write : from.write) {
-        for (auto to_read : to.read) {
-          if (from_write.version == to_read.version) {
-            dag.AddEdge(from, to);
-          }
+  std::unordered_map<ResourceVersion, std::vector<RenderGraph::NodeHandle>> writers;
+  for (const auto& node : dag) {
+    for (auto write : node.write) {
+      writers[write.version].push_back(dag.GetNodeHandle(node));
+    }
+  }
+
+  for (const auto& node : dag) {
+    auto to_handle = dag.GetNodeHandle(node);
+
+    for (auto read : node.read) {
+      auto it = writers.find(read.version);
+      if (it == writers.end()) {
+        continue;
+      }
+
+      for (auto from_handle : it->second) {
+        if (from_handle != to_handle) {
+          dag.AddEdge(from_handle, to_handle);
         }
       }
     }
   }
 
+  /* Redundant edges would only produce redundant semaphore waits/signals */
+  dag.TransitiveReduction();
+
   dag.TopologicalSort(graph_->sorted_nodes_, graph_->node_dependency_levels_, graph_->max_dependency_level_);
 
   auto add_usage = [&](auto node_handle, auto resource_id, auto state) {
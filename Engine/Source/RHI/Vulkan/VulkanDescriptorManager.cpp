@@ -136,18 +136,16 @@ bool VulkanDescriptorManager::Init(VulkanDevice& device) {
   VULKAN_CALL(vkAllocateDescriptorSets(device_, &allocate_info, &set_));
   device.SetDebugName(set_, "VulkanDescriptorManager::set_");
 
-  /* Initialize free binding sets */
-  auto initialize_set = [](auto& free_bindings) {
-    free_bindings.reserve(kMaxBindlessResourcesPerType);
-    for (uint32_t binding = 1U; binding < kMaxBindlessResourcesPerType; ++binding) {
-      free_bindings.insert(binding);
-    }
+  /* Initialize free binding lists, binding 0 is reserved for Invalid */
+  auto initialize_free_list = [](auto& free_bindings) {
+    free_bindings = FreeList(kMaxBindlessResourcesPerType, FreeListPolicy::LowestIndexFirst);
+    [[maybe_unused]] auto invalid_binding = free_bindings.Allocate();
   };
 
-  initialize_set(free_bindings_uniform_buffer_);
-  initialize_set(free_bindings_storage_buffer_);
-  initialize_set(free_bindings_sampled_texture_);
-  initialize_set(free_bindings_storage_texture_);
+  initialize_free_list(free_bindings_uniform_buffer_);
+  initialize_free_list(free_bindings_storage_buffer_);
+  initialize_free_list(free_bindings_sampled_texture_);
+  initialize_free_list(free_bindings_storage_texture_);
 
   /* Create default sampler */
   const VkSamplerCreateInfo sampler_info {
@@ -218,10 +216,8 @@ VulkanDescriptorManager::BufferBindings VulkanDescriptorManager::AddBuffer(VkBuf
 
   uint32_t writes_count = 0;
   if (EnumBitmaskContains(buffer_usage, DeviceResourceState::UniformBuffer)) {
-    LIGER_ASSERT(!free_bindings_uniform_buffer_.empty(), kLogChannelRHI, "Max bindless uniform buffers limit reached!");
-
-    uint32_t uniform_binding = *free_bindings_uniform_buffer_.begin();
-    free_bindings_uniform_buffer_.extract(free_bindings_uniform_buffer_.begin());
+    uint32_t uniform_binding = free_bindings_uniform_buffer_.Allocate();
+    LIGER_ASSERT(uniform_binding != FreeList::kInvalidIndex, kLogChannelRHI, "Max bindless uniform buffers limit reached!");
     bindings.uniform = static_cast<BufferDescriptorBinding>(uniform_binding);
 
     writes[writes_count++] = {
@@ -240,10 +236,8 @@ VulkanDescriptorManager::BufferBindings VulkanDescriptorManager::AddBuffer(VkBuf
 
   if (EnumBitmaskContainsAny(buffer_usage, DeviceResourceState::StorageBufferRead |
                                            DeviceResourceState::StorageBufferWrite)) {
-    LIGER_ASSERT(!free_bindings_storage_buffer_.empty(), kLogChannelRHI, "Max bindless storage buffers limit reached!");
-
-    uint32_t storage_binding = *free_bindings_storage_buffer_.begin();
-    free_bindings_storage_buffer_.extract(free_bindings_storage_buffer_.begin());
+    uint32_t storage_binding = free_bindings_storage_buffer_.Allocate();
+    LIGER_ASSERT(storage_binding != FreeList::kInvalidIndex, kLogChannelRHI, "Max bindless storage buffers limit reached!");
     bindings.storage = static_cast<BufferDescriptorBinding>(storage_binding);
 
     writes[writes_count++] = {
@@ -269,11 +263,11 @@ VulkanDescriptorManager::BufferBindings VulkanDescriptorManager::AddBuffer(VkBuf
 
 void VulkanDescriptorManager::RemoveBuffer(BufferBindings bindings) {
   if (bindings.uniform != BufferDescriptorBinding::Invalid) {
-    free_bindings_uniform_buffer_.insert(static_cast<uint32_t>(bindings.uniform));
+    free_bindings_uniform_buffer_.Free(static_cast<uint32_t>(bindings.uniform));
   }
 
   if (bindings.storage != BufferDescriptorBinding::Invalid) {
-    free_bindings_storage_buffer_.insert(static_cast<uint32_t>(bindings.storage));
+    free_bindings_storage_buffer_.Free(static_cast<uint32_t>(bindings.storage));
   }
 }
 
@@ -292,11 +286,9 @@ VulkanDescriptorManager::TextureBindings VulkanDescriptorManager::AddImageView(V
 
   uint32_t writes_count = 0;
   if (EnumBitmaskContains(texture_usage, DeviceResourceState::ShaderSampled)) {
-    LIGER_ASSERT(!free_bindings_sampled_texture_.empty(), kLogChannelRHI,
+    uint32_t sampled_binding = free_bindings_sampled_texture_.Allocate();
+    LIGER_ASSERT(sampled_binding != FreeList::kInvalidIndex, kLogChannelRHI,
                  "Max bindless sampled textures limit reached!");
-
-    uint32_t sampled_binding = *free_bindings_sampled_texture_.begin();
-    free_bindings_sampled_texture_.extract(free_bindings_sampled_texture_.begin());
     bindings.sampled = static_cast<TextureDescriptorBinding>(sampled_binding);
 
     image_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -316,11 +308,9 @@ VulkanDescriptorManager::TextureBindings VulkanDescriptorManager::AddImageView(V
 
   if (EnumBitmaskContainsAny(texture_usage, DeviceResourceState::StorageTextureRead |
                                             DeviceResourceState::StorageTextureWrite)) {
-    LIGER_ASSERT(!free_bindings_storage_texture_.empty(), kLogChannelRHI,
+    uint32_t storage_binding = free_bindings_storage_texture_.Allocate();
+    LIGER_ASSERT(storage_binding != FreeList::kInvalidIndex, kLogChannelRHI,
                  "Max bindless storage textures limit reached!");
-
-    uint32_t storage_binding = *free_bindings_storage_texture_.begin();
-    free_bindings_storage_texture_.extract(free_bindings_storage_texture_.begin());
     bindings.storage = static_cast<TextureDescriptorBinding>(storage_binding);
 
     image_info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
@@ -371,11 +361,11 @@ void VulkanDescriptorManager::UpdateSampler(TextureDescriptorBinding sampled_bin
 
 void VulkanDescriptorManager::RemoveImageView(TextureBindings bindings) {
   if (bindings.sampled != TextureDescriptorBinding::Invalid) {
-    free_bindings_sampled_texture_.insert(static_cast<uint32_t>(bindings.sampled));
+    free_bindings_sampled_texture_.Free(static_cast<uint32_t>(bindings.sampled));
   }
 
   if (bindings.storage != TextureDescriptorBinding::Invalid) {
-    free_bindings_storage_texture_.insert(static_cast<uint32_t>(bindings.storage));
+    free_bindings_storage_texture_.Free(static_cast<uint32_t>(bindings.storage));
   }
 }
 
@@ -27,13 +27,12 @@
 
 #pragma once
 
+#include <Liger-Engine/Core/Containers/FreeList.hpp>
 #include <Liger-Engine/RHI/DescriptorBinding.hpp>
 #include <Liger-Engine/RHI/DeviceResourceState.hpp>
 
 #include "VulkanUtils.hpp"
 
-#include <unordered_set>
-
 namespace liger::rhi {
 
 class VulkanDevice;
@@ -84,10 +83,11 @@ class VulkanDescriptorManager {
   VkDescriptorSet       set_     {VK_NULL_HANDLE};
   VkSampler             sampler_ {VK_NULL_HANDLE};
 
-  std::unordered_set<uint32_t> free_bindings_uniform_buffer_;
-  std::unordered_set<uint32_t> free_bindings_storage_buffer_;
-  std::unordered_set<uint32_t> free_bindings_sampled_texture_;
-  std::unordered_set<uint32_t> free_bindings_storage_texture_;
+  /* Lowest bindings are reused first to keep the used part of the descriptor arrays compact */
+  FreeList              free_bindings_uniform_buffer_;
+  FreeList              free_bindings_storage_buffer_;
+  FreeList              free_bindings_sampled_texture_;
+  FreeList              free_bindings_storage_texture_;
 };
 
 }  // namespace liger::rhi
\ No newline at end of file
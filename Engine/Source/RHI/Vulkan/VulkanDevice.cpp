@@ -34,6 +34,8 @@
 #include "VulkanTexture.hpp"
 #include "VulkanUtils.hpp"
 
+#include <Liger-Engine/Core/Memory/FrameAllocator.hpp>
+
 #define VMA_IMPLEMENTATION
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -192,6 +194,8 @@ void VulkanDevice::WaitIdle() {
 }
 
 std::optional<uint32_t> VulkanDevice::BeginFrame(ISwapchain& swapchain) {
+  FrameArena::BeginFrame();
+
   current_swapchain_ = static_cast<VulkanSwapchain*>(&swapchain);
   auto& frame_sync = frame_sync_[CurrentFrame()];
 
@@ -281,11 +285,48 @@ bool VulkanDevice::EndFrame() {
 }
 
 void VulkanDevice::BeginOffscreenFrame() {
-  // TODO(tralf-strues): Implement!
+  FrameArena::BeginFrame();
+
+  auto& frame_sync = frame_sync_[CurrentFrame()];
+
+  VULKAN_CALL(vkWaitForFences(device_, 1, &frame_sync.fence_render_finished, VK_TRUE, UINT64_MAX));
+  VULKAN_CALL(vkResetFences(device_, 1, &frame_sync.fence_render_finished));
+
+  current_swapchain_ = nullptr;
+  current_graph_idx_ = 0;
+
+  transfer_engine_.Submit();
 }
 
 void VulkanDevice::EndOffscreenFrame() {
-  // TODO(tralf-strues): Implement!
+  auto& frame_sync  = frame_sync_[CurrentFrame()];
+  auto  empty_frame = (current_graph_idx_ == 0);
+
+  const VkSemaphoreSubmitInfo last_graph_wait {
+    .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+    .pNext       = nullptr,
+    .semaphore   = render_graph_semaphore_.Get(),
+    .value       = CalculateRenderGraphSemaphoreValue(current_graph_idx_),
+    .stageMask   = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT,
+    .deviceIndex = 0
+  };
+
+  /* Submitted even if the frame is empty, so that the fence is always signaled */
+  const VkSubmitInfo2 submit {
+    .sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+    .pNext                    = nullptr,
+    .flags                    = 0,
+    .waitSemaphoreInfoCount   = empty_frame ? 0U : 1U,
+    .pWaitSemaphoreInfos      = empty_frame ? nullptr : &last_graph_wait,
+    .commandBufferInfoCount   = 0,
+    .pCommandBufferInfos      = nullptr,
+    .signalSemaphoreInfoCount = 0,
+    .pSignalSemaphoreInfos    = nullptr
+  };
+
+  VULKAN_CALL(vkQueueSubmit2(queue_set_.GetMainQueue(), 1, &submit, frame_sync.fence_render_finished));
+
+  IncrementFrame();
 }
 
 uint32_t VulkanDevice::CurrentFrame() const {
@@ -310,7 +351,11 @@ void VulkanDevice::ExecuteConsecutive(RenderGraph& render_graph, Context& contex
 
   auto first_graph    = (current_graph_idx_ == 0);
   auto wait_value     = first_graph ? 0 : CalculateRenderGraphSemaphoreValue(current_graph_idx_);
-  auto wait_semaphore = first_graph ? frame_sync.semaphore_swapchain_acquire : render_graph_semaphore_.Get();
+  auto wait_semaphore = render_graph_semaphore_.Get();
+  if (first_graph) {
+    /* Offscreen frames have nothing to wait for before the first graph */
+    wait_semaphore = (current_swapchain_ != nullptr) ? frame_sync.semaphore_swapchain_acquire : VK_NULL_HANDLE;
+  }
 
   ++current_graph_idx_;
 
@@ -323,6 +368,22 @@ void VulkanDevice::RequestDedicatedTransfer(DedicatedTransferRequest&& transfer)
   transfer_engine_.Request(std::move(transfer));
 }
 
+IDevice::MemoryUsage VulkanDevice::GetMemoryUsage() const {
+  const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+  vmaGetMemoryProperties(vma_allocator_, &memory_properties);
+
+  std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+  vmaGetHeapBudgets(vma_allocator_, budgets.data());
+
+  MemoryUsage usage;
+  for (uint32_t heap_idx = 0; heap_idx < memory_properties->memoryHeapCount; ++heap_idx) {
+    usage.used_bytes   += budgets[heap_idx].usage;
+    usage.budget_bytes += budgets[heap_idx].budget;
+  }
+
+  return usage;
+}
+
 RenderGraphBuilder VulkanDevice::NewRenderGraphBuilder(Context& context) {
   return RenderGraphBuilder(std::make_unique<VulkanRenderGraph>(), context);
 }
@@ -89,6 +89,8 @@ class VulkanDevice : public IDevice {
 
   void RequestDedicatedTransfer(DedicatedTransferRequest&& transfer) override;
 
+  MemoryUsage GetMemoryUsage() const override;
+
   RenderGraphBuilder NewRenderGraphBuilder(Context& context) override;
 
   [[nodiscard]] std::unique_ptr<ISwapchain> CreateSwapchain(const ISwapchain::Info& info) override;
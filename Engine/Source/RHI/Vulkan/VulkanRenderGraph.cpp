@@ -28,6 +28,7 @@
 #include "VulkanRenderGraph.hpp"
 
 #include <Liger-Engine/Core/EnumReflection.hpp>
+#include <Liger-Engine/Core/Memory/FrameAllocator.hpp>
 #include "VulkanBuffer.hpp"
 #include "VulkanTexture.hpp"
 
@@ -38,6 +39,12 @@
 
 namespace liger::rhi {
 
+VulkanRenderGraph::~VulkanRenderGraph() {
+  if (timestamp_query_pool_ != VK_NULL_HANDLE) {
+    vkDestroyQueryPool(device_->GetVulkanDevice(), timestamp_query_pool_, nullptr);
+  }
+}
+
 void VulkanRenderGraph::ReimportTexture(ResourceVersion version, TextureResource new_texture) {
   resource_version_registry_.UpdateResource(resource_version_registry_.GetResourceId(version), new_texture);
   dirty_ = true;
@@ -49,17 +56,18 @@ void VulkanRenderGraph::ReimportBuffer(ResourceVersion version, BufferResource n
 }
 
 void VulkanRenderGraph::UpdateTransientTextureSamples(ResourceVersion version, uint8_t new_sample_count) {
-  auto& texture_info = transient_texture_infos_[resource_version_registry_.GetResourceId(version)];
+  /* at() never inserts, so different resources can be updated concurrently */
+  auto& texture_info = transient_texture_infos_.at(resource_version_registry_.GetResourceId(version));
   if (texture_info.samples.Get() != new_sample_count) {
-    force_recreate_resources_ = true;
+    force_recreate_resources_.store(true, std::memory_order_relaxed);
     texture_info.samples = new_sample_count;
   }
 }
 
 void VulkanRenderGraph::UpdateTransientBufferSize(ResourceVersion version, uint64_t new_size) {
-  auto& buffer_info = transient_buffer_infos_[resource_version_registry_.GetResourceId(version)];
+  auto& buffer_info = transient_buffer_infos_.at(resource_version_registry_.GetResourceId(version));
   if (buffer_info.size != new_size) {
-    force_recreate_resources_ = true;
+    force_recreate_resources_.store(true, std::memory_order_relaxed);
     buffer_info.size = new_size;
   }
 }
@@ -89,12 +97,22 @@ void VulkanRenderGraph::Execute(Context& context, VkSemaphore wait, uint64_t wai
 
   auto frame_idx = device_->CurrentFrame();
   command_pool_.Reset(frame_idx);
+  ReadTimestamps(frame_idx);
+
+  bool timestamp_begin_written = false;
 
   auto submit = [&](uint32_t queue_idx, auto& submit_it, auto& cmds) {
+    if (timestamp_begin_written && queue_idx == 0 && submit_it + 1 == submits_per_queue_[queue_idx].end()) {
+      vkCmdWriteTimestamp2(cmds->Get(), VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, timestamp_query_pool_, 2U * frame_idx + 1U);
+      timestamps_written_[frame_idx] = 1U;
+    }
+
     cmds->End();
 
-    std::vector<VkSemaphoreSubmitInfo> wait_semaphores;
-    std::vector<VkSemaphoreSubmitInfo> signal_semaphores;
+    FrameVector<VkSemaphoreSubmitInfo> wait_semaphores;
+    FrameVector<VkSemaphoreSubmitInfo> signal_semaphores;
+    wait_semaphores.reserve(queue_count_ + 1U);
+    signal_semaphores.reserve(2U);
 
     for (uint32_t wait_queue_idx = 0; wait_queue_idx < queue_count_; ++wait_queue_idx) {
       auto wait_info = submit_it->wait_per_queue[wait_queue_idx];
@@ -182,6 +200,12 @@ void VulkanRenderGraph::Execute(Context& context, VkSemaphore wait, uint64_t wai
       if (!cmds) {
         cmds = command_pool_.AllocateCommandBuffer(frame_idx, queue_idx);
         cmds->Begin();
+
+        if (queue_idx == 0 && !timestamp_begin_written && timestamp_query_pool_ != VK_NULL_HANDLE) {
+          vkCmdResetQueryPool(cmds->Get(), timestamp_query_pool_, 2U * frame_idx, 2U);
+          vkCmdWriteTimestamp2(cmds->Get(), VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, timestamp_query_pool_, 2U * frame_idx);
+          timestamp_begin_written = true;
+        }
       }
 
       const auto& original_node = dag_.GetNode(GetNodeHandle(*node));
@@ -274,6 +298,7 @@ void VulkanRenderGraph::Compile(IDevice& device) {
   SetupAttachments();
   SetupBarriers();
   CreateSemaphores();
+  CreateTimestampQueries();
 
   command_pool_.Init(*device_, device_->GetFramesInFlight(), device_->GetDescriptorManager().GetSet(),
                      device_->GetQueues(), device_->GetDebugEnabled());
@@ -1074,6 +1099,53 @@ void VulkanRenderGraph::CreateSemaphores() {
   }
 }
 
+void VulkanRenderGraph::CreateTimestampQueries() {
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(device_->GetPhysicalDevice(), &properties);
+
+  if (properties.limits.timestampComputeAndGraphics == VK_FALSE) {
+    LIGER_LOG_WARN(kLogChannelRHI, "Device does not support timestamps, GPU time of '{}' is unavailable", name_);
+    return;
+  }
+
+  timestamp_period_ns_ = properties.limits.timestampPeriod;
+  timestamps_written_.assign(device_->GetFramesInFlight(), 0U);
+
+  const VkQueryPoolCreateInfo query_pool_info {
+    .sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+    .pNext              = nullptr,
+    .flags              = 0,
+    .queryType          = VK_QUERY_TYPE_TIMESTAMP,
+    .queryCount         = 2U * device_->GetFramesInFlight(),
+    .pipelineStatistics = 0
+  };
+
+  VULKAN_CALL(vkCreateQueryPool(device_->GetVulkanDevice(), &query_pool_info, nullptr, &timestamp_query_pool_));
+  device_->SetDebugName(timestamp_query_pool_, "VulkanRenderGraph({0})::timestamp_query_pool_", name_);
+}
+
+void VulkanRenderGraph::ReadTimestamps(uint32_t frame_idx) {
+  /* The frame's fence has been waited for, so the queries written during its previous execution are complete */
+  if (timestamp_query_pool_ == VK_NULL_HANDLE || timestamps_written_[frame_idx] == 0U) {
+    return;
+  }
+
+  std::array<uint64_t, 2> timestamps{};
+  const auto result = vkGetQueryPoolResults(device_->GetVulkanDevice(), timestamp_query_pool_, 2U * frame_idx, 2U,
+                                            sizeof(timestamps), timestamps.data(), sizeof(uint64_t),
+                                            VK_QUERY_RESULT_64_BIT);
+
+  if (result == VK_SUCCESS) {
+    last_gpu_time_ms_ = static_cast<float>(timestamps[1] - timestamps[0]) * timestamp_period_ns_ * 1e-6f;
+  }
+
+  timestamps_written_[frame_idx] = 0U;
+}
+
+std::optional<float> VulkanRenderGraph::LastGpuTimeMs() const {
+  return last_gpu_time_ms_;
+}
+
 void VulkanRenderGraph::DumpGraphviz(std::string_view filename, bool detailed) {
   std::ofstream os(filename.data(), std::ios::out);
   if (!os.is_open()) {
@@ -1318,13 +1390,23 @@ void VulkanRenderGraph::SetBufferPackBarriers(VkCommandBuffer vk_cmds, VulkanNod
     return;
   }
 
-  std::vector<VkBufferMemoryBarrier2> barriers;
+  auto get_pack = [this](size_t barrier_idx) {
+    return *resource_version_registry_.TryGetResourceById<BufferPackResource>(buffer_pack_barrier_resources_[barrier_idx]);
+  };
+
+  size_t barrier_count = 0U;
+  for (uint32_t i = 0U; i < vulkan_node.in_buffer_pack_barrier_count; ++i) {
+    barrier_count += get_pack(vulkan_node.in_buffer_pack_barrier_begin_idx + i).buffers->size();
+  }
+
+  FrameVector<VkBufferMemoryBarrier2> barriers;
+  barriers.reserve(barrier_count);
+
   for (uint32_t i = 0U; i < vulkan_node.in_buffer_pack_barrier_count; ++i) {
     const size_t start_idx   = barriers.size();
     const size_t barrier_idx = vulkan_node.in_buffer_pack_barrier_begin_idx + i;
 
-    auto pack =
-      *resource_version_registry_.TryGetResourceById<BufferPackResource>(buffer_pack_barrier_resources_[barrier_idx]);
+    auto pack = get_pack(barrier_idx);
     barriers.insert(barriers.end(), pack.buffers->size(), vk_buffer_pack_barriers_[barrier_idx]);
 
     for (size_t buffer_idx = 0U; buffer_idx < pack.buffers->size(); ++buffer_idx) {
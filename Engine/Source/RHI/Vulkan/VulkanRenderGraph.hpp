@@ -31,6 +31,7 @@
 #include "VulkanDevice.hpp"
 #include "VulkanTimelineSemaphore.hpp"
 
+#include <atomic>
 #include <vector>
 
 // XLib has macro None...
@@ -42,7 +43,7 @@ class VulkanRenderGraph : public RenderGraph {
  public:
   static constexpr uint32_t kMaxQueuesSupported = 3;
 
-  ~VulkanRenderGraph() override = default;
+  ~VulkanRenderGraph() override;
 
   void ReimportTexture(ResourceVersion version, TextureResource new_texture) override;
   void ReimportBuffer(ResourceVersion version, BufferResource new_buffer) override;
@@ -53,6 +54,8 @@ class VulkanRenderGraph : public RenderGraph {
 
   void DumpGraphviz(std::string_view filename, bool detailed) override;
 
+  std::optional<float> LastGpuTimeMs() const override;
+
   static glm::vec4 GetDebugLabelColor(JobType node_type);
 
  private:
@@ -102,6 +105,8 @@ class VulkanRenderGraph : public RenderGraph {
   void SetupBarriers();
   void LinkBarriersToResources();
   void CreateSemaphores();
+  void CreateTimestampQueries();
+  void ReadTimestamps(uint32_t frame_idx);
 
   VulkanNode& GetVulkanNode(const Node& node);
   VulkanNode& GetVulkanNode(NodeHandle node_handle);
@@ -111,10 +116,10 @@ class VulkanRenderGraph : public RenderGraph {
 
   void SetBufferPackBarriers(VkCommandBuffer vk_cmds, VulkanNode& vulkan_node) const;
 
-  VulkanDevice* device_{nullptr};
-  bool          dirty_{false};
-  bool          force_recreate_resources_{false};
-  bool          first_frame_{true};
+  VulkanDevice*     device_{nullptr};
+  bool              dirty_{false};
+  std::atomic<bool> force_recreate_resources_{false};
+  bool              first_frame_{true};
 
   std::vector<VulkanNode> vulkan_nodes_;
 
@@ -133,6 +138,11 @@ class VulkanRenderGraph : public RenderGraph {
   std::array<std::vector<Submit>, kMaxQueuesSupported>      submits_per_queue_;
   std::array<VulkanTimelineSemaphore, kMaxQueuesSupported>  semaphores_per_queue_;
 
+  VkQueryPool          timestamp_query_pool_{VK_NULL_HANDLE};
+  float                timestamp_period_ns_{0.0f};
+  std::vector<uint8_t> timestamps_written_;
+  std::optional<float> last_gpu_time_ms_;
+
   std::vector<VkImageMemoryBarrier2>  vk_image_barriers_;
   std::vector<ResourceId>             image_barrier_resources_;
   std::vector<VkBufferMemoryBarrier2> vk_buffer_barriers_;
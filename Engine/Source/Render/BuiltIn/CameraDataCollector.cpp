@@ -37,7 +37,7 @@ void CameraDataCollector::SetupEntitySystems(ecs::SystemGraph& systems) {
 }
 
 void CameraDataCollector::Run(const ecs::Camera& camera, const ecs::WorldTransform& transform) {
-  auto* data        = ubo_camera_data_.GetData();
+  auto* data        = &camera_data_.Simulated();
   data->view        = transform.InverseMatrix();
   data->proj        = camera.ProjectionMatrix();
   data->proj_view   = data->proj * data->view;
@@ -47,8 +47,15 @@ void CameraDataCollector::Run(const ecs::Camera& camera, const ecs::WorldTransfo
   data->far         = camera.far;
 }
 
+void CameraDataCollector::Extract() {
+  camera_data_.Extract();
+}
+
 void CameraDataCollector::PreRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context& context) {
-  context.Insert(*ubo_camera_data_.GetData());
+  /* Written here rather than in Run, since simulation may overlap with the render work of the previous frame */
+  *ubo_camera_data_.GetData() = camera_data_.Extracted();
+
+  context.Insert(camera_data_.Extracted());
   context.Insert(CameraDataBinding{.binding_ubo = ubo_camera_data_->GetUniformDescriptorBinding()});
 }
 
@@ -29,13 +29,21 @@
 
 namespace liger::render {
 
-ClusteredLightFeature::ClusteredLightFeature(asset::Manager& asset_manager)
+ClusteredLightFeature::ClusteredLightFeature(asset::Manager& asset_manager, tf::Executor& executor)
     : gen_volumes_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.ClusteredLightGenVolumes.lshader")),
-      cull_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.ClusteredLightCull.lshader")) {}
+      cull_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.ClusteredLightCull.lshader")),
+      executor_(executor) {
+  for (auto* buffers : {&point_lights_.Simulated(), &point_lights_.Extracted()}) {
+    buffers->Resize(static_cast<uint32_t>(executor_.num_workers()));
+    buffers->ForEach([](auto& point_lights) { point_lights.reserve(kInitialLightCapacity); });
+  }
+
+  EnableParallelIteration();
+}
 
 void ClusteredLightFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
   rg_versions_.point_lights = builder.DeclareTransientBuffer(rhi::IBuffer::Info {
-    .size        = sizeof(PointLight) * 64U,
+    .size        = sizeof(PointLight) * kInitialLightCapacity,
     .usage       = rhi::DeviceResourceState::StorageBufferRead,
     .cpu_visible = true,
     .name        = "Point lights"
@@ -107,8 +115,8 @@ void ClusteredLightFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
     auto sbo_light_clusters             = graph.GetBuffer(rg_versions_.light_clusters);
     auto sbo_contributing_light_indices = graph.GetBuffer(rg_versions_.contributing_light_indices);
 
-    auto* raw_lights = sbo_point_lights->MapMemory();
-    std::memcpy(raw_lights, point_lights_.data(), sizeof(PointLight) * point_lights_.size());
+    auto* raw_lights = reinterpret_cast<PointLight*>(sbo_point_lights->MapMemory());
+    CopyContiguous(point_lights_.Extracted(), raw_lights);
     sbo_point_lights->UnmapMemory();
 
     cull_shader_->BindPipeline(cmds);
@@ -118,7 +126,7 @@ void ClusteredLightFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
     cull_shader_->SetBuffer("ClusterVolumes",           sbo_cluster_volumes->GetStorageDescriptorBinding());
     cull_shader_->SetBuffer("LightClusters",            sbo_light_clusters->GetStorageDescriptorBinding());
     cull_shader_->SetBuffer("ContributingLightIndices", sbo_contributing_light_indices->GetStorageDescriptorBinding());
-    cull_shader_->SetPushConstant("light_count",        static_cast<uint32_t>(point_lights_.size()));
+    cull_shader_->SetPushConstant("light_count",        point_lights_count_);
     cull_shader_->SetPushConstant("screen_resolution",  glm::uvec2(screen_resolution.x, screen_resolution.y));
 
     cull_shader_->BindPushConstants(cmds);
@@ -140,7 +148,7 @@ void ClusteredLightFeature::SetupEntitySystems(ecs::SystemGraph& systems) {
 }
 
 void ClusteredLightFeature::Run(const ecs::WorldTransform& transform, const PointLightInfo& point_light) {
-  point_lights_.emplace_back(PointLight {
+  point_lights_.Simulated().Local(executor_.this_worker_id()).emplace_back(PointLight {
     .ws_position = transform.position,
     .radius      = point_light.radius,
     .color       = point_light.color,
@@ -148,6 +156,11 @@ void ClusteredLightFeature::Run(const ecs::WorldTransform& transform, const Poin
   });
 }
 
+void ClusteredLightFeature::Extract() {
+  point_lights_.Extract().ForEach([](auto& point_lights) { point_lights.clear(); });
+  point_lights_count_ = static_cast<uint32_t>(TotalSize(point_lights_.Extracted()));
+}
+
 void ClusteredLightFeature::PreRender(rhi::IDevice&, rhi::RenderGraph& graph, rhi::Context& context) {
   auto output_extent = graph.GetTexture(context.template Get<OutputTexture>().rg_final_color).texture->GetInfo().extent;
 
@@ -162,7 +175,7 @@ void ClusteredLightFeature::PreRender(rhi::IDevice&, rhi::RenderGraph& graph, rh
     updated_        = true;
   }
 
-  graph.UpdateTransientBufferSize(rg_versions_.point_lights, point_lights_.size() * sizeof(PointLight));
+  graph.UpdateTransientBufferSize(rg_versions_.point_lights, point_lights_count_ * sizeof(PointLight));
   graph.UpdateTransientBufferSize(rg_versions_.pre_cluster_volumes, sizeof(AABB) * TotalClustersCount());
   graph.UpdateTransientBufferSize(rg_versions_.contributing_light_indices, sizeof(uint32_t) * (1U + TotalClustersCount()) * kMaxLightsPerCluster);
   graph.UpdateTransientBufferSize(rg_versions_.light_clusters, TotalClustersCount() * sizeof(LightCluster));
@@ -183,7 +196,6 @@ void ClusteredLightFeature::PreRender(rhi::IDevice&, rhi::RenderGraph& graph, rh
 }
 
 void ClusteredLightFeature::PostRender(rhi::IDevice&, rhi::RenderGraph&, rhi::Context&) {
-  point_lights_.clear();
   updated_ = false;
 }
 
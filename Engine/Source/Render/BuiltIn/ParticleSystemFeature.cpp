@@ -27,6 +27,9 @@
 
 #include <Liger-Engine/Render/BuiltIn/ParticleSystemFeature.hpp>
 
+#include <Liger-Engine/ECS/ConstructBatch.hpp>
+#include <Liger-Engine/Render/LogChannel.hpp>
+
 namespace liger::render {
 
 class InitializeParticleEmitter : public ecs::ExclusiveComponentSystem<const ParticleEmitterInfo> {
@@ -35,10 +38,37 @@ class InitializeParticleEmitter : public ecs::ExclusiveComponentSystem<const Par
   ~InitializeParticleEmitter() override = default;
 
   void Setup(entt::registry& registry) override {
+    batch_signals_ = &ecs::ConstructBatchSignals::Get(registry);
+    batch_signals_->OnConstruct<ParticleEmitterInfo>().connect<&InitializeParticleEmitter::OnAttachBatch>(this);
+
     registry.on_construct<ParticleEmitterInfo>().connect<&InitializeParticleEmitter::OnAttach>(this);
+    registry.on_update<ParticleEmitterInfo>().connect<&InitializeParticleEmitter::OnUpdate>(this);
+    registry.on_destroy<ParticleEmitterInfo>().connect<&InitializeParticleEmitter::OnDetach>(this);
+    registry.on_destroy<RuntimeParticleEmitterHandle>().connect<&InitializeParticleEmitter::OnRuntimeHandleDestroy>(this);
+  }
+
+  void OnAttachBatch(entt::registry& registry, std::span<const ecs::Entity> entities) {
+    std::vector<ecs::Entity>                  new_entities;
+    std::vector<RuntimeParticleEmitterHandle> handles;
+    new_entities.reserve(entities.size());
+    handles.reserve(entities.size());
+
+    auto view = registry.view<const ParticleEmitterInfo>();
+    for (auto entity : entities) {
+      if (!registry.all_of<RuntimeParticleEmitterHandle>(entity)) {
+        new_entities.push_back(entity);
+        handles.push_back(feature_.Add(view.get<const ParticleEmitterInfo>(entity)));
+      }
+    }
+
+    registry.insert<RuntimeParticleEmitterHandle>(new_entities.begin(), new_entities.end(), handles.begin());
   }
 
   void OnAttach(entt::registry& registry, entt::entity entity) {
+    if (batch_signals_->InBatch<ParticleEmitterInfo>()) {
+      return;
+    }
+
     const auto& emitter_info = registry.get<ParticleEmitterInfo>(entity);
 
     auto* runtime_handle_ptr = registry.try_get<RuntimeParticleEmitterHandle>(entity);
@@ -47,12 +77,28 @@ class InitializeParticleEmitter : public ecs::ExclusiveComponentSystem<const Par
     }
   }
 
+  void OnUpdate(entt::registry& registry, entt::entity entity) {
+    auto* runtime_handle_ptr = registry.try_get<RuntimeParticleEmitterHandle>(entity);
+    if (runtime_handle_ptr != nullptr) {
+      *runtime_handle_ptr = feature_.Replace(*runtime_handle_ptr, registry.get<ParticleEmitterInfo>(entity));
+    }
+  }
+
+  void OnDetach(entt::registry& registry, entt::entity entity) {
+    registry.remove<RuntimeParticleEmitterHandle>(entity);
+  }
+
+  void OnRuntimeHandleDestroy(entt::registry& registry, entt::entity entity) {
+    feature_.Remove(registry.get<RuntimeParticleEmitterHandle>(entity));
+  }
+
   void Run(entt::registry& registry, entt::entity entity, const ParticleEmitterInfo& emitter_info) override {}
 
   std::string_view Name() const override { return "InitializeParticleEmitter<const ParticleEmitterInfo>"; }
 
  private:
-  ParticleSystemFeature& feature_;
+  ParticleSystemFeature&      feature_;
+  ecs::ConstructBatchSignals* batch_signals_{nullptr};
 };
 
 class UpdateParticleEmitter : public ecs::ComponentSystem<const RuntimeParticleEmitterHandle,
@@ -83,7 +129,10 @@ ParticleSystemFeature::ParticleSystemFeature(rhi::IDevice& device, asset::Manage
       update_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.ParticleUpdate.lshader")),
       render_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.ParticleRender.lshader")),
       frame_timer_(frame_timer) {
-  instances_.reserve(kMaxParticleSystems);
+  instances_.resize(kMaxParticleSystems);
+  active_instances_.reserve(kMaxParticleSystems);
+  pending_remove_.reserve(kMaxParticleSystems);
+  retired_emitters_.reserve(kMaxParticleSystems);
 
   sbo_init_free_list_ = device_.CreateBuffer(rhi::IBuffer::Info {
     .size        = (kMaxParticlesPerEmitter + 1U) * sizeof(int32_t),
@@ -125,23 +174,21 @@ void ParticleSystemFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
       return;
     }
 
-    for (auto& instance : instances_) {
+    for (auto idx : active_instances_) {
+      auto& instance = instances_[idx];
       if (instance.initialized) {
         continue;
       }
 
-      graph.GetBufferPack(rg_versions_.emit_free_list).buffers->push_back(instance.sbo_free_list.get());
-      graph.GetBufferPack(rg_versions_.emit_particles).buffers->push_back(instance.sbo_particles.get());
-      graph.GetBufferPack(rg_versions_.update_draw_command).buffers->push_back(instance.sbo_draw_command.get());
-      graph.GetBufferPack(rg_versions_.update_draw_particle_indices).buffers->push_back(instance.sbo_draw_particle_indices.get());
-
       cmds.CopyBuffer(sbo_init_free_list_.get(), instance.sbo_free_list.get(), instance.sbo_free_list->GetInfo().size);
 
       instance.initialized = true;
     }
 
     emit_shader_->BindPipeline(cmds);
-    for (auto& instance : instances_) {
+    for (auto idx : active_instances_) {
+      auto& instance = instances_[idx];
+
       float particles_to_spawn = 0.0f;
       instance.pending_spawn = std::modf(instance.pending_spawn, &particles_to_spawn);
 
@@ -173,7 +220,8 @@ void ParticleSystemFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
 
     update_shader_->BindPipeline(cmds);
     update_shader_->SetPushConstant("delta_time", frame_timer_.DeltaTime());
-    for (auto& instance : instances_) {
+    for (auto idx : active_instances_) {
+      auto& instance = instances_[idx];
       update_shader_->SetBuffer("EmitterData",         instance.ubo_emitter->GetUniformDescriptorBinding());
       update_shader_->SetBuffer("Particles",           instance.sbo_particles->GetStorageDescriptorBinding());
       update_shader_->SetBuffer("FreeList",            instance.sbo_free_list->GetStorageDescriptorBinding());
@@ -204,7 +252,8 @@ void ParticleSystemFeature::AddLayerJobs(LayerMap& layer_map) {
 
     render_shader_->BindPipeline(cmds);
     render_shader_->SetBuffer("CameraData", context.template Get<CameraDataBinding>().binding_ubo);
-    for (auto& instance : instances_) {
+    for (auto idx : active_instances_) {
+      auto& instance = instances_[idx];
       render_shader_->SetPushConstant("transform",     instance.transform);
       render_shader_->SetBuffer("EmitterData",         instance.ubo_emitter->GetUniformDescriptorBinding());
       render_shader_->SetBuffer("Particles",           instance.sbo_particles->GetStorageDescriptorBinding());
@@ -221,12 +270,127 @@ void ParticleSystemFeature::SetupEntitySystems(liger::ecs::SystemGraph& systems)
   systems.Emplace(std::make_unique<UpdateParticleEmitter>(*this));
 }
 
+void ParticleSystemFeature::Extract() {
+  active_instances_.clear();
+
+  /* Removed emitters stop being rendered right away, but their slots are only reused later, see RetireEmitters */
+  for (auto handle : pending_remove_) {
+    if (auto* emitter = emitters_.Get(handle); emitter != nullptr && !emitter->removed) {
+      emitter->removed = true;
+      retired_emitters_.emplace_back(RetiredEmitter{.handle = handle, .extract_idx = extract_count_});
+    }
+  }
+  pending_remove_.clear();
+
+  RetireEmitters();
+  ++extract_count_;
+
+  for (uint32_t dense_idx = 0U; dense_idx < emitters_.Size(); ++dense_idx) {
+    const auto idx      = emitters_.HandleAt(dense_idx).index;
+    auto&      emitter  = emitters_.Values()[dense_idx];
+    auto&      instance = instances_[idx];
+
+    if (emitter.removed) {
+      continue;
+    }
+
+    /* Device resources are created here rather than in Add, since Extract never overlaps with the render work */
+    if (!instance.ubo_emitter) {
+      CreateInstance(idx, emitter.max_particles);
+    }
+
+    if (emitter.updated) {
+      instance.emitter_data   = emitter.emitter_data;
+      instance.transform      = emitter.transform;
+      instance.pending_spawn += emitter.spawn;
+      instance.data_updated   = true;
+
+      emitter.spawn   = 0.0f;
+      emitter.updated = false;
+    }
+
+    active_instances_.push_back(idx);
+  }
+}
+
+void ParticleSystemFeature::PreRender(rhi::IDevice&, rhi::RenderGraph& graph, rhi::Context&) {
+  /* Packs are refilled every frame, so that they never reference the buffers of removed instances */
+  auto* free_lists            = graph.GetBufferPack(rg_versions_.emit_free_list).buffers;
+  auto* particles             = graph.GetBufferPack(rg_versions_.emit_particles).buffers;
+  auto* draw_commands         = graph.GetBufferPack(rg_versions_.update_draw_command).buffers;
+  auto* draw_particle_indices = graph.GetBufferPack(rg_versions_.update_draw_particle_indices).buffers;
+
+  free_lists->clear();
+  particles->clear();
+  draw_commands->clear();
+  draw_particle_indices->clear();
+
+  for (auto idx : active_instances_) {
+    auto& instance = instances_[idx];
+    if (instance.data_updated) {
+      *instance.ubo_emitter.GetData() = instance.emitter_data;
+      instance.data_updated           = false;
+    }
+
+    free_lists->push_back(instance.sbo_free_list.get());
+    particles->push_back(instance.sbo_particles.get());
+    draw_commands->push_back(instance.sbo_draw_command.get());
+    draw_particle_indices->push_back(instance.sbo_draw_particle_indices.get());
+  }
+}
+
 RuntimeParticleEmitterHandle ParticleSystemFeature::Add(const ParticleEmitterInfo& emitter_info) {
-  const auto idx = static_cast<uint32_t>(instances_.size());
+  LIGER_ASSERT(emitters_.Size() < kMaxParticleSystems, kLogChannelRender, "No more space left in ParticleSystemFeature");
+
+  /* The instance is only handed over to the render work in Extract */
+  auto handle = emitters_.Emplace(SimulatedEmitter {
+    .emitter_data  = ParticleEmitterUBO(emitter_info),
+    .max_particles = emitter_info.max_particles
+  });
+
+  return RuntimeParticleEmitterHandle{.runtime_handle = handle};
+}
+
+void ParticleSystemFeature::Remove(RuntimeParticleEmitterHandle handle) {
+  pending_remove_.push_back(handle.runtime_handle);
+}
+
+RuntimeParticleEmitterHandle ParticleSystemFeature::Replace(RuntimeParticleEmitterHandle handle,
+                                                            const ParticleEmitterInfo& emitter_info) {
+  /* Everything but the particle count is applied by Update every frame */
+  const auto* emitter = emitters_.Get(handle.runtime_handle);
+  if (emitter != nullptr && emitter->max_particles == emitter_info.max_particles) {
+    return handle;
+  }
+
+  Remove(handle);
+  return Add(emitter_info);
+}
+
+void ParticleSystemFeature::Update(RuntimeParticleEmitterHandle handle,
+                                   const ParticleEmitterInfo& emitter_info,
+                                   const glm::mat4& transform) {
+  auto* emitter = emitters_.Get(handle.runtime_handle);
+  if (emitter == nullptr) {
+    return;
+  }
+
+  /* The emitter system may not be run every frame, so particles are spawned for the whole time since the last update */
+  const float time = frame_timer_.AbsoluteTime();
+  const float dt   = (emitter->last_update_time < 0.0f) ? frame_timer_.DeltaTime() : time - emitter->last_update_time;
+
+  emitter->emitter_data     = ParticleEmitterUBO(emitter_info);
+  emitter->transform        = transform;
+  emitter->spawn           += emitter_info.spawn_rate * dt;
+  emitter->last_update_time = time;
+  emitter->updated          = true;
+}
 
-  auto& instance = instances_.emplace_back();
+void ParticleSystemFeature::CreateInstance(uint32_t idx, uint32_t max_particles) {
+  auto& instance = instances_[idx];
 
-  instance.max_particles = emitter_info.max_particles;
+  instance = Instance{};
+  instance.max_particles = max_particles;
 
   instance.ubo_emitter = rhi::UniqueMappedBuffer<ParticleEmitterUBO>(
       device_,
@@ -261,18 +425,24 @@ RuntimeParticleEmitterHandle ParticleSystemFeature::Add(const ParticleEmitterInf
     .cpu_visible = false,
     .name        = fmt::format("ParticleSystemFeature::instances_[{0}]::sbo_draw_particle_indices", idx)
   });
-
-  return RuntimeParticleEmitterHandle{.runtime_handle = idx};
 }
 
-void ParticleSystemFeature::Update(RuntimeParticleEmitterHandle handle,
-                                   const ParticleEmitterInfo& emitter_info,
-                                   const glm::mat4& transform) {
-  uint32_t idx = handle.runtime_handle;
-  
-  *instances_[idx].ubo_emitter.GetData() = ParticleEmitterUBO(emitter_info);
-  instances_[idx].transform              = transform;
-  instances_[idx].pending_spawn         += emitter_info.spawn_rate * frame_timer_.DeltaTime();
+void ParticleSystemFeature::RetireEmitters() {
+  /* Frames in flight may still use an instance removed up to that many extracts ago */
+  const uint64_t frames_in_flight = device_.GetFramesInFlight();
+
+  size_t retired_count = 0U;
+  while (retired_count < retired_emitters_.size() &&
+         retired_emitters_[retired_count].extract_idx + frames_in_flight <= extract_count_) {
+    const auto handle = retired_emitters_[retired_count].handle;
+
+    /* Device resources are released, so that an emitter reusing the slot creates its own instance */
+    instances_[handle.index] = Instance{};
+    emitters_.Erase(handle);
+    ++retired_count;
+  }
+
+  retired_emitters_.erase(retired_emitters_.begin(), retired_emitters_.begin() + retired_count);
 }
 
 bool ParticleSystemFeature::Initialized() const {
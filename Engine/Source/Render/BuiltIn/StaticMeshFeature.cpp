@@ -27,6 +27,7 @@
 
 #include <Liger-Engine/Render/BuiltIn/StaticMeshFeature.hpp>
 
+#include <Liger-Engine/Core/Math/TransformBatch.hpp>
 #include <Liger-Engine/Render/BuiltIn/CameraData.hpp>
 #include <Liger-Engine/Render/BuiltIn/ClusteredLightData.hpp>
 #include <Liger-Engine/Render/LogChannel.hpp>
@@ -37,13 +38,30 @@ inline glm::vec4 NormalizePlane(const glm::vec4& plane) {
   return plane / glm::length(glm::vec3(plane));
 }
 
-StaticMeshFeature::StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset_manager)
+StaticMeshFeature::StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset_manager, tf::Executor& executor)
     : device_(device),
+      executor_(executor),
+      object_slots_(kMaxObjects, FreeListPolicy::LowestIndexFirst),
       cull_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.StaticMeshCull.lshader")),
+      scatter_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.StaticMeshScatter.lshader")),
       render_shader_(asset_manager.GetAsset<shader::Shader>(".liger/Shaders/BuiltIn.StaticMeshRender.lshader")) {
   pending_remove_.reserve(kMaxObjects);
-  free_list_.reserve(kMaxObjects);
+  retired_objects_.reserve(kMaxObjects);
+  for (auto* simulated : {&simulated_objects_.Simulated(), &simulated_objects_.Extracted()}) {
+    simulated->Resize(static_cast<uint32_t>(executor_.num_workers()));
+    simulated->ForEach([](SimulatedObjects& objects) {
+      objects.transforms.reserve(kMaxObjects);
+      objects.transform_objects.reserve(kMaxObjects);
+      objects.added_objects.reserve(kReservedObjectSlots);
+    });
+  }
+  reserved_slots_.reserve(kReservedObjectSlots);
+  ReserveObjectSlots();
+  last_transforms_.resize(kMaxObjects);
+  pending_matrices_.reserve(kMaxObjects);
+  dirty_objects_.reserve(kMaxObjects);
   objects_.resize(kMaxObjects);
+  objects_alive_.resize(kMaxObjects, false);
   index_buffers_per_object_.resize(kMaxObjects, nullptr);
   batched_objects_.reserve(kMaxObjects);
   draw_commands_.reserve(kMaxMeshes);
@@ -51,7 +69,7 @@ StaticMeshFeature::StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset
 
   sbo_objects_ = device.CreateBuffer(rhi::IBuffer::Info {
     .size        = kMaxObjects * sizeof(Object),
-    .usage       = rhi::DeviceResourceState::StorageBufferRead | rhi::DeviceResourceState::TransferDst,
+    .usage       = rhi::DeviceResourceState::StorageBufferReadWrite | rhi::DeviceResourceState::TransferDst,
     .cpu_visible = false,
     .name        = "StaticMeshFeature - Objects"
   });
@@ -70,9 +88,7 @@ StaticMeshFeature::StaticMeshFeature(rhi::IDevice& device, asset::Manager& asset
     .name        = "StaticMeshFeature - Draw Cmds"
   });
 
-  for (uint32_t object_idx = 0U; object_idx < kMaxObjects; ++object_idx) {
-    free_list_.insert(object_idx);
-  }
+  EnableParallelIteration();
 }
 
 void StaticMeshFeature::UpdateMode(DebugMode new_mode) {
@@ -100,39 +116,61 @@ void StaticMeshFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
     .name        = "StaticMeshFeature - Visible Objects"
   });
 
+  rg_versions_.object_updates = builder.DeclareTransientBuffer(IBuffer::Info {
+    .size        = kMaxObjects * sizeof(Object),
+    .usage       = DeviceResourceState::StorageBufferRead,
+    .cpu_visible = true,
+    .name        = "StaticMeshFeature - Object Updates"
+  });
+
+  rg_versions_.object_update_indices = builder.DeclareTransientBuffer(IBuffer::Info {
+    .size        = kMaxObjects * sizeof(uint32_t),
+    .usage       = DeviceResourceState::StorageBufferRead,
+    .cpu_visible = true,
+    .name        = "StaticMeshFeature - Object Update Indices"
+  });
+
   builder.BeginTransfer("Static Mesh - Prepare");
   builder.ReadBuffer(rg_versions_.staging_buffer,   DeviceResourceState::TransferSrc);
   builder.WriteBuffer(rg_versions_.objects,         DeviceResourceState::TransferDst);
   builder.WriteBuffer(rg_versions_.batched_objects, DeviceResourceState::TransferDst);
   builder.WriteBuffer(rg_versions_.draw_commands,   DeviceResourceState::TransferDst);
   builder.SetJob([this](auto& graph, auto& context, auto& cmds) {
-    bool prepare_draws_only = false;
+    UpdateTransforms();
 
-    if (objects_added_ || !pending_remove_.empty()) {
+    /* Moved objects are scattered on the GPU, unless the whole array has to be uploaded anyway */
+    const bool upload_objects = objects_changed_ || scatter_shader_.GetState() != asset::State::Loaded;
+
+    if (objects_changed_) {
       Rebuild(cmds);
-      prepare_draws_only = false;
     }
 
     if (draw_commands_.empty()) {
+      dirty_objects_.clear();
       return;
     }
 
     auto  staging_buffer = graph.GetBuffer(rg_versions_.staging_buffer);
     auto* staging_data   = staging_buffer->MapMemory();
 
-    uint64_t objects_data_size         = objects_.size() * sizeof(objects_[0U]);
+    /* Object slots are allocated lowest first, so only the beginning of the array is in use */
+    uint64_t objects_data_size         = objects_end_ * sizeof(objects_[0U]);
     uint64_t batched_objects_data_size = batched_objects_.size() * sizeof(batched_objects_[0U]);
     uint64_t draw_commands_data_size   = draw_commands_.size() * sizeof(draw_commands_[0U]);
 
     uint64_t offset = 0U;
-    if (!prepare_draws_only) {
+    if (upload_objects) {
       std::memcpy(reinterpret_cast<uint8_t*>(staging_data) + offset, objects_.data(), objects_data_size);
       cmds.CopyBuffer(staging_buffer, sbo_objects_.get(), objects_data_size, offset, 0U);
       offset += objects_data_size;
       std::memcpy(reinterpret_cast<uint8_t*>(staging_data) + offset, batched_objects_.data(), batched_objects_data_size);
       cmds.CopyBuffer(staging_buffer, sbo_batched_objects_.get(), batched_objects_data_size, offset, 0U);
       offset += batched_objects_data_size;
+
+      dirty_objects_.clear();
     }
+
+    /* Instance counts are accumulated by the culling pass, so draw commands are reset every frame */
     std::memcpy(reinterpret_cast<uint8_t*>(staging_data) + offset, draw_commands_.data(), draw_commands_data_size);
     cmds.CopyBuffer(staging_buffer, sbo_draw_commands_.get(), draw_commands_data_size, offset, 0U);
 
@@ -140,8 +178,44 @@ void StaticMeshFeature::SetupRenderGraph(rhi::RenderGraphBuilder& builder) {
   });
   builder.EndTransfer();
 
+  builder.BeginCompute("Static Mesh - Scatter Objects");
+  builder.ReadBuffer(rg_versions_.object_updates,        DeviceResourceState::StorageBufferRead);
+  builder.ReadBuffer(rg_versions_.object_update_indices, DeviceResourceState::StorageBufferRead);
+  rg_versions_.scattered_objects = builder.ReadWriteBuffer(rg_versions_.objects, DeviceResourceState::StorageBufferReadWrite);
+  builder.SetJob([this](auto& graph, auto& context, auto& cmds) {
+    if (dirty_objects_.empty()) {
+      return;
+    }
+
+    auto sbo_object_updates        = graph.GetBuffer(rg_versions_.object_updates);
+    auto sbo_object_update_indices = graph.GetBuffer(rg_versions_.object_update_indices);
+
+    auto* updates = reinterpret_cast<Object*>(sbo_object_updates->MapMemory());
+    for (size_t i = 0U; i < dirty_objects_.size(); ++i) {
+      updates[i] = objects_[dirty_objects_[i]];
+    }
+    sbo_object_updates->UnmapMemory();
+
+    auto* indices = sbo_object_update_indices->MapMemory();
+    std::memcpy(indices, dirty_objects_.data(), dirty_objects_.size() * sizeof(dirty_objects_[0U]));
+    sbo_object_update_indices->UnmapMemory();
+
+    scatter_shader_->BindPipeline(cmds);
+
+    scatter_shader_->SetBuffer("ObjectUpdates",              sbo_object_updates->GetStorageDescriptorBinding());
+    scatter_shader_->SetBuffer("ObjectUpdateIndices",        sbo_object_update_indices->GetStorageDescriptorBinding());
+    scatter_shader_->SetBuffer("Objects",                    sbo_objects_->GetStorageDescriptorBinding());
+    scatter_shader_->SetPushConstant<uint32_t>("update_count", static_cast<uint32_t>(dirty_objects_.size()));
+
+    scatter_shader_->BindPushConstants(cmds);
+    cmds.Dispatch((dirty_objects_.size() + 63U) / 64U, 1U, 1U);
+
+    dirty_objects_.clear();
+  });
+  builder.EndCompute();
+
   builder.BeginCompute("Static Mesh - Frustum Cull");
-  builder.ReadBuffer(rg_versions_.objects,                 DeviceResourceState::StorageBufferRead);
+  builder.ReadBuffer(rg_versions_.scattered_objects,       DeviceResourceState::StorageBufferRead);
   builder.ReadBuffer(rg_versions_.batched_objects,         DeviceResourceState::StorageBufferRead);
   builder.WriteBuffer(rg_versions_.visible_object_indices, DeviceResourceState::StorageBufferWrite);
   rg_versions_.final_draw_commands = builder.ReadWriteBuffer(rg_versions_.draw_commands, DeviceResourceState::StorageBufferReadWrite);
@@ -181,7 +255,7 @@ void StaticMeshFeature::AddLayerJobs(LayerMap& layer_map) {
     builder.ReadBuffer(clustered_data.rg_point_lights,               rhi::DeviceResourceState::StorageBufferRead);
     builder.ReadBuffer(clustered_data.rg_contributing_light_indices, rhi::DeviceResourceState::StorageBufferRead);
     builder.ReadBuffer(clustered_data.rg_light_clusters,             rhi::DeviceResourceState::StorageBufferRead);
-    builder.ReadBuffer(rg_versions_.objects,                         rhi::DeviceResourceState::StorageBufferRead);
+    builder.ReadBuffer(rg_versions_.scattered_objects,               rhi::DeviceResourceState::StorageBufferRead);
     builder.ReadBuffer(rg_versions_.visible_object_indices,          rhi::DeviceResourceState::StorageBufferRead);
     builder.ReadBuffer(rg_versions_.final_draw_commands,             rhi::DeviceResourceState::IndirectArgument);
   });
@@ -219,64 +293,195 @@ void StaticMeshFeature::SetupEntitySystems(ecs::SystemGraph& systems) {
   systems.Insert(this);
 }
 
+void StaticMeshFeature::Setup(entt::registry& registry) {
+  registry.on_destroy<StaticMeshComponent>().connect<&StaticMeshFeature::OnStaticMeshDestroy>(this);
+  registry.on_update<StaticMeshComponent>().connect<&StaticMeshFeature::OnStaticMeshUpdate>(this);
+  registry.on_destroy<ecs::WorldTransform>().connect<&StaticMeshFeature::OnTransformDestroy>(this);
+}
+
 void StaticMeshFeature::Run(const ecs::WorldTransform& transform, StaticMeshComponent& static_mesh) {
   if (static_mesh.mesh.GetState() != asset::State::Loaded) {
     return;
   }
 
   const uint32_t submeshes_count = static_mesh.mesh->submeshes.size();
+  auto&          simulated       = simulated_objects_.Simulated().Local(executor_.this_worker_id());
 
   if (static_mesh.runtime_submesh_handles.size() != submeshes_count) {
-    static_mesh.runtime_submesh_handles.resize(submeshes_count);
-
-    for (uint32_t submesh_idx = 0U; submesh_idx < submeshes_count; ++submesh_idx) {
-      const auto& submesh    = static_mesh.mesh->submeshes[submesh_idx];
-      auto&       object_idx = static_mesh.runtime_submesh_handles[submesh_idx];
-      if (submesh.material.GetState() != asset::State::Loaded) {
-        continue;
-      }
-
-      object_idx = AddObject(Object {
-        .binding_mesh     = submesh.ubo->GetUniformDescriptorBinding(),
-        .binding_material = submesh.material->ubo->GetUniformDescriptorBinding(),
-        .vertex_count     = submesh.vertex_count,
-        .index_count      = submesh.index_count
-      });
-
-      index_buffers_per_object_[object_idx] = static_mesh.mesh->submeshes[submesh_idx].index_buffer.get();
+    static_mesh.runtime_submesh_handles.resize(submeshes_count, StaticMeshComponent::kInvalidRuntimeHandle);
+  }
+
+  /* Submeshes are retried until their material is loaded */
+  for (uint32_t submesh_idx = 0U; submesh_idx < submeshes_count; ++submesh_idx) {
+    const auto& submesh    = static_mesh.mesh->submeshes[submesh_idx];
+    auto&       object_idx = static_mesh.runtime_submesh_handles[submesh_idx];
+    if (object_idx != StaticMeshComponent::kInvalidRuntimeHandle ||
+        submesh.material.GetState() != asset::State::Loaded) {
+      continue;
+    }
+
+    object_idx = AddObject(simulated, Object {
+      .binding_mesh     = submesh.ubo->GetUniformDescriptorBinding(),
+      .binding_material = submesh.material->ubo->GetUniformDescriptorBinding(),
+      .vertex_count     = submesh.vertex_count,
+      .index_count      = submesh.index_count
+    }, submesh.index_buffer.get());
+
+    if (object_idx != StaticMeshComponent::kInvalidRuntimeHandle) {
+      simulated.transforms.emplace_back(transform);
+      simulated.transform_objects.emplace_back(object_idx);
     }
   }
 
+  /* Only moved objects are passed on, their matrices are composed in a single batch, see UpdateTransforms */
   for (auto object_idx : static_mesh.runtime_submesh_handles) {
-    objects_[object_idx].transform = transform.Matrix();
+    if (object_idx == StaticMeshComponent::kInvalidRuntimeHandle || last_transforms_[object_idx] == transform) {
+      continue;
+    }
+
+    last_transforms_[object_idx] = transform;
+    simulated.transforms.emplace_back(transform);
+    simulated.transform_objects.emplace_back(object_idx);
+  }
+}
+
+void StaticMeshFeature::Extract() {
+  simulated_objects_.Extract().ForEach([](SimulatedObjects& objects) {
+    objects.transforms.clear();
+    objects.transform_objects.clear();
+    objects.added_objects.clear();
+  });
+
+  /* Neither the systems nor the render work are running, so the render side objects can be modified directly */
+  simulated_objects_.Extracted().ForEach([this](SimulatedObjects& objects) {
+    for (auto& added : objects.added_objects) {
+      objects_[added.object_idx]                  = std::move(added.object);
+      objects_alive_[added.object_idx]            = true;
+      index_buffers_per_object_[added.object_idx] = added.index_buffer;
+      objects_changed_                            = true;
+    }
+  });
+
+  /* Removed objects are dropped from the batches right away, but their slots are only reused later, see RetireObjects */
+  for (auto object_idx : pending_remove_) {
+    objects_alive_[object_idx]            = false;
+    index_buffers_per_object_[object_idx] = nullptr;
+    retired_objects_.emplace_back(RetiredObject{.object_idx = object_idx, .extract_idx = extract_count_});
+    objects_changed_ = true;
   }
+  pending_remove_.clear();
+
+  RetireObjects();
+  ++extract_count_;
+
+  ReserveObjectSlots();
+
+  objects_end_ = object_slots_.End();
 }
 
-uint32_t StaticMeshFeature::AddObject(Object object) {
-  LIGER_ASSERT(!free_list_.empty(), kLogChannelRender, "No more space left in StaticMeshFeature");
+uint32_t StaticMeshFeature::AddObject(SimulatedObjects& simulated, Object object, rhi::IBuffer* index_buffer) {
+  const auto reserved_idx = reserved_slots_used_.fetch_add(1U, std::memory_order_relaxed);
+
+  uint32_t object_idx;
+  if (reserved_idx < reserved_slots_.size()) {
+    object_idx = reserved_slots_[reserved_idx];
+  } else {
+    /* More objects are added in this frame than slots have been reserved, e.g. when a scene is loaded */
+    std::lock_guard lock(object_slots_mutex_);
+    object_idx = object_slots_.Allocate();
+  }
 
-  auto it         = free_list_.begin();
-  auto object_idx = *it;
+  LIGER_ASSERT(object_idx != FreeList::kInvalidIndex, kLogChannelRender, "No more space left in StaticMeshFeature");
+  if (object_idx == FreeList::kInvalidIndex) {
+    return StaticMeshComponent::kInvalidRuntimeHandle;
+  }
 
-  objects_[object_idx] = std::move(object);
-  objects_added_       = true;
+  /* Objects are only handed over to the render work in Extract */
+  simulated.added_objects.emplace_back(AddedObject {
+    .object_idx   = object_idx,
+    .object       = std::move(object),
+    .index_buffer = index_buffer
+  });
 
-  free_list_.erase(it);
   return object_idx;
 }
 
-void StaticMeshFeature::Rebuild(rhi::ICommandBuffer& cmds) {
-  /* Add and remove objects */
-  for (auto object_idx : pending_remove_) {
-    free_list_.insert(object_idx);
+void StaticMeshFeature::RemoveObjects(StaticMeshComponent& static_mesh) {
+  for (auto object_idx : static_mesh.runtime_submesh_handles) {
+    if (object_idx != StaticMeshComponent::kInvalidRuntimeHandle) {
+      pending_remove_.push_back(object_idx);
+    }
   }
-  pending_remove_.clear();
 
+  static_mesh.runtime_submesh_handles.clear();
+}
+
+void StaticMeshFeature::RetireObjects() {
+  /* Frames in flight may still read a slot removed up to that many extracts ago */
+  const uint64_t frames_in_flight = device_.GetFramesInFlight();
+
+  size_t retired_count = 0U;
+  while (retired_count < retired_objects_.size() &&
+         retired_objects_[retired_count].extract_idx + frames_in_flight <= extract_count_) {
+    object_slots_.Free(retired_objects_[retired_count].object_idx);
+    ++retired_count;
+  }
+
+  retired_objects_.erase(retired_objects_.begin(), retired_objects_.begin() + retired_count);
+
+  retired_count = 0U;
+  while (retired_count < retired_index_buffers_.size() &&
+         retired_index_buffers_[retired_count].extract_idx + frames_in_flight <= extract_count_) {
+    ++retired_count;
+  }
+
+  retired_index_buffers_.erase(retired_index_buffers_.begin(), retired_index_buffers_.begin() + retired_count);
+}
+
+void StaticMeshFeature::OnStaticMeshDestroy(entt::registry& registry, entt::entity entity) {
+  RemoveObjects(registry.get<StaticMeshComponent>(entity));
+}
+
+void StaticMeshFeature::OnStaticMeshUpdate(entt::registry& registry, entt::entity entity) {
+  /* The objects are added again for the new mesh by the next Run */
+  RemoveObjects(registry.get<StaticMeshComponent>(entity));
+}
+
+void StaticMeshFeature::OnTransformDestroy(entt::registry& registry, entt::entity entity) {
+  if (auto* static_mesh = registry.try_get<StaticMeshComponent>(entity); static_mesh != nullptr) {
+    RemoveObjects(*static_mesh);
+  }
+}
+
+void StaticMeshFeature::ReserveObjectSlots() {
+  const auto used = std::min<size_t>(reserved_slots_used_.load(std::memory_order_relaxed), reserved_slots_.size());
+  reserved_slots_.erase(reserved_slots_.begin(), reserved_slots_.begin() + used);
+  reserved_slots_used_.store(0U, std::memory_order_relaxed);
+
+  while (reserved_slots_.size() < kReservedObjectSlots && !object_slots_.Full()) {
+    reserved_slots_.push_back(object_slots_.Allocate());
+  }
+}
+
+void StaticMeshFeature::UpdateTransforms() {
+  simulated_objects_.Extracted().ForEach([this](const SimulatedObjects& objects) {
+    pending_matrices_.resize(objects.transforms.size());
+    transform_batch::ComposeMatrices(objects.transforms, pending_matrices_.data());
+
+    for (size_t i = 0U; i < pending_matrices_.size(); ++i) {
+      objects_[objects.transform_objects[i]].transform = pending_matrices_[i];
+    }
+
+    dirty_objects_.insert(dirty_objects_.end(), objects.transform_objects.begin(), objects.transform_objects.end());
+  });
+}
+
+void StaticMeshFeature::Rebuild(rhi::ICommandBuffer& cmds) {
   /* Initialize batched objects list */
   batched_objects_.clear();
 
-  for (uint32_t object_idx = 0U; object_idx < objects_.size(); ++object_idx) {
-    if (free_list_.find(object_idx) != free_list_.end()) {
+  for (uint32_t object_idx = 0U; object_idx < objects_end_; ++object_idx) {
+    if (!objects_alive_[object_idx]) {
       continue;
     }
 
@@ -293,8 +498,16 @@ void StaticMeshFeature::Rebuild(rhi::ICommandBuffer& cmds) {
   index_buffer_copies_.clear();
   merged_index_buffer_total_size_ = 0U;
 
+  /* All objects have been removed */
+  if (batched_objects_.empty()) {
+    objects_changed_ = false;
+    return;
+  }
+
   auto add_batch = [this](uint32_t from_idx, uint32_t batch_idx) {
     uint32_t object_idx = batched_objects_[from_idx].object_idx;
+    LIGER_ASSERT(index_buffers_per_object_[object_idx] != nullptr, kLogChannelRender,
+                 "Batched object {0} has no index buffer, it has been removed", object_idx);
 
     uint64_t copy_size = index_buffers_per_object_[object_idx]->GetInfo().size;
     index_buffer_copies_.emplace_back(CopyCmd {
@@ -327,22 +540,33 @@ void StaticMeshFeature::Rebuild(rhi::ICommandBuffer& cmds) {
   }
   add_batch(last_from_idx, batch_idx);
 
-  if (!merged_index_buffer_ || merged_index_buffer_->GetInfo().size > merged_index_buffer_total_size_) {
+  if (!merged_index_buffer_ || merged_index_buffer_->GetInfo().size < merged_index_buffer_total_size_) {
+    /* Frames in flight may still draw with the previous buffer, so it is only destroyed once they have retired */
+    uint64_t new_size = merged_index_buffer_total_size_;
+    if (merged_index_buffer_) {
+      new_size = std::max(new_size, 2U * merged_index_buffer_->GetInfo().size);
+      retired_index_buffers_.emplace_back(RetiredBuffer{.buffer = std::move(merged_index_buffer_),
+                                                        .extract_idx = extract_count_});
+    }
+
     merged_index_buffer_ = device_.CreateBuffer(rhi::IBuffer::Info {
-      .size        = merged_index_buffer_total_size_,
+      .size        = new_size,
       .usage       = rhi::DeviceResourceState::TransferDst | rhi::DeviceResourceState::IndexBuffer,
       .cpu_visible = false,
       .name        = "StaticMeshFeature::merged_index_buffer_"
     });
   }
 
+  LIGER_ASSERT(merged_index_buffer_->GetInfo().size >= merged_index_buffer_total_size_, kLogChannelRender,
+               "Merged index buffer is too small for the batched meshes");
+
   for (auto& copy : index_buffer_copies_) {
     cmds.CopyBuffer(copy.src, merged_index_buffer_.get(), copy.size, 0U, copy.dst_offset);
     cmds.BufferBarrier(merged_index_buffer_.get(), rhi::DeviceResourceState::TransferDst,
                        rhi::DeviceResourceState::IndexBuffer);
   }
 
-  objects_added_ = false;
+  objects_changed_ = false;
 }
 
 }  // namespace liger::render
\ No newline at end of file
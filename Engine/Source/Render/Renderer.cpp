@@ -27,6 +27,11 @@
 
 #include <Liger-Engine/Render/Renderer.hpp>
 
+#include <Liger-Engine/Core/Time.hpp>
+#include <Liger-Engine/Render/LogChannel.hpp>
+
+#include <unordered_map>
+
 namespace liger::render {
 
 Renderer::Renderer(rhi::IDevice& device) : device_(device), rg_builder_(device_.NewRenderGraphBuilder(context_)) {}
@@ -60,24 +65,121 @@ void Renderer::Setup() {
   for (auto& feature : features_) {
     feature->SetupEntitySystems(system_graph_);
   }
+
+  feature_stats_.clear();
+  for (auto& feature : features_) {
+    feature_stats_.emplace_back(FeatureStats{.name = feature->Name()});
+  }
 }
 
 rhi::RenderGraphBuilder& Renderer::GetRenderGraphBuilder() { return rg_builder_; }
 
 tf::Taskflow Renderer::GetSystemTaskflow(ecs::Scene& scene) { return system_graph_.Build(scene); }
 
+ecs::SystemGraph& Renderer::GetSystemGraph() { return system_graph_; }
+
 rhi::RenderGraph& Renderer::GetRenderGraph() { return *render_graph_; }
 
 void Renderer::Render() {
-  for (auto& feature : features_) {
-    feature->PreRender(device_, *render_graph_, context_);
+  Extract();
+
+  for (size_t feature_idx = 0; feature_idx < features_.size(); ++feature_idx) {
+    PreRender(feature_idx);
   }
 
-  device_.ExecuteConsecutive(*render_graph_, context_);
+  Execute();
+
+  for (size_t feature_idx = 0; feature_idx < features_.size(); ++feature_idx) {
+    PostRender(feature_idx);
+  }
+}
 
+void Renderer::Extract() {
+  Timer timer;
   for (auto& feature : features_) {
-    feature->PostRender(device_, *render_graph_, context_);
+    feature->Extract();
+  }
+  extract_time_ms_ = timer.ElapsedMs();
+}
+
+FrameTaskGraph::TaskId Renderer::AddFrameTasks(FrameTaskGraph& graph, FrameTaskGraph::TaskId after) {
+  /* Execution is on the critical path of every frame */
+  auto execute = graph.Emplace("Render: Execute", [this]() { Execute(); }, TaskPriority::High);
+  auto end     = graph.Marker("Render: End");
+
+  std::unordered_map<std::string_view, size_t> feature_indices;
+  for (size_t feature_idx = 0; feature_idx < features_.size(); ++feature_idx) {
+    feature_indices[features_[feature_idx]->Name()] = feature_idx;
   }
+
+  /* Features others depend on unblock more work, so they are scheduled first */
+  std::vector<bool> has_dependents(features_.size(), false);
+  for (const auto& feature : features_) {
+    for (auto dependency : feature->DependencyFeatures()) {
+      if (auto it = feature_indices.find(dependency); it != feature_indices.end()) {
+        has_dependents[it->second] = true;
+      }
+    }
+  }
+
+  std::vector<FrameTaskGraph::TaskId> pre_render_tasks;
+  std::vector<FrameTaskGraph::TaskId> post_render_tasks;
+
+  for (size_t feature_idx = 0; feature_idx < features_.size(); ++feature_idx) {
+    auto name     = std::string(features_[feature_idx]->Name());
+    auto priority = has_dependents[feature_idx] ? TaskPriority::High : TaskPriority::Normal;
+
+    auto pre_render  = graph.Emplace("PreRender: " + name, [this, feature_idx]() { PreRender(feature_idx); }, priority);
+    auto post_render = graph.Emplace("PostRender: " + name, [this, feature_idx]() { PostRender(feature_idx); });
+
+    graph.Precede(after, pre_render);
+    graph.Precede(pre_render, execute);
+    graph.Precede(execute, post_render);
+    graph.Precede(post_render, end);
+
+    pre_render_tasks.push_back(pre_render);
+    post_render_tasks.push_back(post_render);
+  }
+
+  for (size_t feature_idx = 0; feature_idx < features_.size(); ++feature_idx) {
+    for (auto dependency : features_[feature_idx]->DependencyFeatures()) {
+      auto it = feature_indices.find(dependency);
+      if (it == feature_indices.end()) {
+        LIGER_LOG_WARN(kLogChannelRender, "Feature '{0}' depends on '{1}', which is not added to the renderer",
+                       features_[feature_idx]->Name(), dependency);
+        continue;
+      }
+
+      graph.Precede(pre_render_tasks[it->second], pre_render_tasks[feature_idx]);
+      graph.Precede(post_render_tasks[it->second], post_render_tasks[feature_idx]);
+    }
+  }
+
+  return end;
+}
+
+std::span<const Renderer::FeatureStats> Renderer::GetFeatureStats() const { return feature_stats_; }
+
+float Renderer::GetExecuteTimeMs() const { return execute_time_ms_; }
+
+float Renderer::GetExtractTimeMs() const { return extract_time_ms_; }
+
+void Renderer::PreRender(size_t feature_idx) {
+  Timer timer;
+  features_[feature_idx]->PreRender(device_, *render_graph_, context_);
+  feature_stats_[feature_idx].pre_render_ms = timer.ElapsedMs();
+}
+
+void Renderer::Execute() {
+  Timer timer;
+  device_.ExecuteConsecutive(*render_graph_, context_);
+  execute_time_ms_ = timer.ElapsedMs();
+}
+
+void Renderer::PostRender(size_t feature_idx) {
+  Timer timer;
+  features_[feature_idx]->PostRender(device_, *render_graph_, context_);
+  feature_stats_[feature_idx].post_render_ms = timer.ElapsedMs();
 }
 
 }  // namespace liger::render
\ No newline at end of file